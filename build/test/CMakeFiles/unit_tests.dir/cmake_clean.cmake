@@ -0,0 +1,277 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unit_tests.dir/bson/src/bson_cursor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_cursor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_decimal128_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_decimal128_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_encoder_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_encoder_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_oid_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_oid_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_reader_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_reader_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_test_suite.cpp.o"
+  "CMakeFiles/unit_tests.dir/bson/src/bson_test_suite.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/bson/src/encode_decode_bson_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/bson/src/encode_decode_bson_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_bitset_traits_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_bitset_traits_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_cursor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_cursor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_encoder_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_encoder_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_event_reader_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_event_reader_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_event_visitor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_event_visitor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_reader_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_reader_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_typed_array_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/cbor_typed_array_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/decode_cbor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/decode_cbor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/cbor/src/encode_cbor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/cbor/src/encode_cbor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/JSONTestSuite_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/JSONTestSuite_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/decode_traits_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/decode_traits_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/detail/optional_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/detail/optional_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/detail/span_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/detail/span_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/detail/string_view_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/detail/string_view_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/detail/to_integer_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/detail/to_integer_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/double_round_trip_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/double_round_trip_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/double_to_string_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/double_to_string_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/dtoa_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/dtoa_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/encode_decode_json_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/encode_decode_json_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/encode_traits_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/encode_traits_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_array_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_array_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_as_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_as_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_assignment_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_assignment_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_bitset_traits_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_bitset_traits_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_checker_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_checker_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_compare_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_compare_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_const_pointer_arg_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_const_pointer_arg_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_constructor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_constructor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_cursor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_cursor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_encoder_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_encoder_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_exception_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_exception_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_filter_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_filter_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_in_place_update_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_in_place_update_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_integer_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_integer_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_less_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_less_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_line_split_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_line_split_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_literal_operator_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_literal_operator_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_object_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_object_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_options_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_options_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_parser_error_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_parser_error_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_parser_position_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_parser_position_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_parser_recovery_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_parser_recovery_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_parser_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_parser_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_pointer_arg_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_pointer_arg_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_push_back_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_push_back_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_reader_exception_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_reader_exception_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_reader_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_reader_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_storage_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_storage_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_swap_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_swap_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_traits_macro_functional_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_traits_macro_functional_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_traits_macro_limit_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_traits_macro_limit_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_traits_macro_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_traits_macro_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_traits_name_macro_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_traits_name_macro_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_type_traits_chrono_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_type_traits_chrono_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_type_traits_container_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_type_traits_container_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_type_traits_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_type_traits_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_validation_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/json_validation_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/jsoncons_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/jsoncons_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/ojson_object_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/ojson_object_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/ojson_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/ojson_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/parse_string_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/parse_string_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/polymorphic_allocator_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/polymorphic_allocator_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/scoped_allocator_adaptor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/scoped_allocator_adaptor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/short_string_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/short_string_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/source_adaptor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/source_adaptor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/source_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/source_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/staj_iterator_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/staj_iterator_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/string_to_double_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/string_to_double_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/testmain.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/testmain.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/bigint_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/bigint_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/byte_string_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/byte_string_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/extension_traits_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/extension_traits_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/heap_string_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/heap_string_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/unicode_conv_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/unicode_conv_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/uri_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/utility/uri_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/value_converter_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/value_converter_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/corelib/src/wjson_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/corelib/src/wjson_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/csv/src/csv_cursor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/csv/src/csv_cursor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/csv/src/csv_reader_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/csv/src/csv_reader_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/csv/src/csv_subfield_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/csv/src/csv_subfield_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/csv/src/csv_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/csv/src/csv_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/csv/src/encode_decode_csv_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/csv/src/encode_decode_csv_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jmespath/src/jmespath_expression_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jmespath/src/jmespath_expression_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jmespath/src/jmespath_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jmespath/src/jmespath_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpatch/src/jsonpatch_test_suite.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpatch/src/jsonpatch_test_suite.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpatch/src/jsonpatch_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpatch/src/jsonpatch_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/json_location_parser_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/json_location_parser_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/json_location_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/json_location_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_custom_function_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_custom_function_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_expression_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_expression_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_flatten_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_flatten_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_function_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_function_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_json_query_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_json_query_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_json_replace_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_json_replace_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_select_paths_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_select_paths_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_stateful_allocator_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_stateful_allocator_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_test_suite.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/jsonpath_test_suite.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/path_node_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpath/src/path_node_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpointer/src/jsonpointer_flatten_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpointer/src/jsonpointer_flatten_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonpointer/src/jsonpointer_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonpointer/src/jsonpointer_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/abort_early_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/abort_early_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/custom_message_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/custom_message_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/dynamic_ref_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/dynamic_ref_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/format_validator_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/format_validator_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/json_schema_walk_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/json_schema_walk_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_defaults_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_defaults_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft201909_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft201909_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft202012_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft202012_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft4_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft4_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft6_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft6_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft7_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/jsonschema_draft7_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/schema_version_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/schema_version_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/validation_report_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/jsonschema/src/validation_report_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/mergepatch/src/mergepatch_test_suite.cpp.o"
+  "CMakeFiles/unit_tests.dir/mergepatch/src/mergepatch_test_suite.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/msgpack/src/decode_msgpack_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/msgpack/src/decode_msgpack_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/msgpack/src/encode_msgpack_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/msgpack/src/encode_msgpack_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_bitset_traits_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_bitset_traits_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_cursor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_cursor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_encoder_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_encoder_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_event_reader_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_event_reader_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_timestamp_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/msgpack/src/msgpack_timestamp_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/ubjson/src/decode_ubjson_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/ubjson/src/decode_ubjson_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/ubjson/src/encode_ubjson_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/ubjson/src/encode_ubjson_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/ubjson/src/ubjson_cursor_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/ubjson/src/ubjson_cursor_tests.cpp.o.d"
+  "CMakeFiles/unit_tests.dir/ubjson/src/ubjson_encoder_tests.cpp.o"
+  "CMakeFiles/unit_tests.dir/ubjson/src/ubjson_encoder_tests.cpp.o.d"
+  "unit_tests"
+  "unit_tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unit_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
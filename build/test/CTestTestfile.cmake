@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unit_tests "/root/repo/build/test/unit_tests")
+set_tests_properties(unit_tests PROPERTIES  WORKING_DIRECTORY "/root/repo/test" _BACKTRACE_TRIPLES "/root/repo/test/CMakeLists.txt;222;add_test;/root/repo/test/CMakeLists.txt;0;")
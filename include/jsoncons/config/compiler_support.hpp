@@ -54,6 +54,14 @@
 
 // https://gcc.gnu.org/bugzilla/show_bug.cgi?id=54577
 
+#if defined(_MSC_VER)
+#define JSONCONS_FORCEINLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define JSONCONS_FORCEINLINE inline __attribute__((always_inline))
+#else
+#define JSONCONS_FORCEINLINE inline
+#endif
+
 #if defined(__GNUC__) || defined(__clang__)
 #define JSONCONS_LIKELY(x) __builtin_expect(!!(x), 1)
 #define JSONCONS_UNLIKELY(x) __builtin_expect(!!(x), 0)
@@ -372,6 +380,38 @@ namespace jsoncons {
 #endif
 #endif
 
+// SIMD support for byte scanning kernels. Define JSONCONS_NO_SIMD to force
+// the portable scalar implementations.
+
+#if !defined(JSONCONS_NO_SIMD)
+#  if defined(__SSE2__) || (defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)))
+#    define JSONCONS_HAS_SSE2 1
+#  endif
+#  if defined(__SSSE3__) || defined(__AVX2__)
+#    define JSONCONS_HAS_SSSE3 1
+#  endif
+#  if defined(__AVX2__)
+#    define JSONCONS_HAS_AVX2 1
+#  endif
+#  if defined(__AVX512BW__)
+#    define JSONCONS_HAS_AVX512BW 1
+#  endif
+#endif
+
+#if defined(JSONCONS_HAS_AVX512BW) && !defined(JSONCONS_HAS_AVX2)
+#  include <immintrin.h>
+#endif
+#if defined(JSONCONS_HAS_AVX2)
+#  include <immintrin.h>
+#elif defined(JSONCONS_HAS_SSSE3)
+#  include <tmmintrin.h>
+#elif defined(JSONCONS_HAS_SSE2)
+#  include <emmintrin.h>
+#endif
+#if defined(JSONCONS_HAS_SSE2) && defined(_MSC_VER)
+#  include <intrin.h> // _BitScanForward
+#endif
+
 // The definitions below follow the definitions in compiler_support_p.h, https://github.com/01org/tinycbor
 // MIT license
 
@@ -32,7 +32,8 @@ namespace detail {
     inline
     char to_hex_character(uint8_t c)
     {
-        return (char)((c < 10) ? ('0' + c) : ('A' - 10 + c));
+        static const char hex_digits[] = "0123456789ABCDEF";
+        return hex_digits[c];
     }
 
     // from_integer
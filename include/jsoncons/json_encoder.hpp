@@ -198,20 +198,23 @@ namespace detail {
     template <typename CharT,typename Sink=jsoncons::stream_sink<CharT>,typename Allocator=std::allocator<char>>
     class basic_json_encoder final : public basic_json_visitor<CharT>
     {
-        static const jsoncons::basic_string_view<CharT> null_constant()
+        // Constant-initialized arrays rather than function-local string_view
+        // statics, whose initializers run through a non-constexpr helper and
+        // so carry a thread-safe once-guard on every call.
+        static jsoncons::basic_string_view<CharT> null_constant()
         {
-            static const jsoncons::basic_string_view<CharT> k = JSONCONS_STRING_VIEW_CONSTANT(CharT, "null");
-            return k;
+            static constexpr CharT k[] = {'n','u','l','l'};
+            return jsoncons::basic_string_view<CharT>(k, 4);
         }
-        static const jsoncons::basic_string_view<CharT> true_constant()
+        static jsoncons::basic_string_view<CharT> true_constant()
         {
-            static const jsoncons::basic_string_view<CharT> k = JSONCONS_STRING_VIEW_CONSTANT(CharT, "true");
-            return k;
+            static constexpr CharT k[] = {'t','r','u','e'};
+            return jsoncons::basic_string_view<CharT>(k, 4);
         }
-        static const jsoncons::basic_string_view<CharT> false_constant()
+        static jsoncons::basic_string_view<CharT> false_constant()
         {
-            static const jsoncons::basic_string_view<CharT> k = JSONCONS_STRING_VIEW_CONSTANT(CharT, "false");
-            return k;
+            static constexpr CharT k[] = {'f','a','l','s','e'};
+            return jsoncons::basic_string_view<CharT>(k, 5);
         }
     public:
         using allocator_type = Allocator;
@@ -318,6 +321,15 @@ namespace detail {
         basic_json_encode_options<CharT> options_;
         jsoncons::detail::write_double fp_;
 
+        // Hot options resolved once at construction; the contextual
+        // line-split getters select against the line_splits() default
+        // on every call.
+        line_split_kind object_object_line_splits_;
+        line_split_kind object_array_line_splits_;
+        line_split_kind array_array_line_splits_;
+        line_split_kind array_object_line_splits_;
+        std::size_t line_length_limit_;
+
         std::vector<encoding_context,encoding_context_allocator_type> stack_;
         int indent_amount_;
         std::size_t column_;
@@ -343,11 +355,16 @@ namespace detail {
         basic_json_encoder(Sink&& sink, 
                            const basic_json_encode_options<CharT>& options, 
                            const Allocator& alloc = Allocator())
-           : sink_(std::forward<Sink>(sink)), 
+           : sink_(std::forward<Sink>(sink)),
              options_(options),
              fp_(options.float_format(), options.precision()),
+             object_object_line_splits_(options.object_object_line_splits()),
+             object_array_line_splits_(options.object_array_line_splits()),
+             array_array_line_splits_(options.array_array_line_splits()),
+             array_object_line_splits_(options.array_object_line_splits()),
+             line_length_limit_(options.line_length_limit()),
              stack_(alloc),
-             indent_amount_(0), 
+             indent_amount_(0),
              column_(0),
              nesting_depth_(0)
         {
@@ -455,11 +472,11 @@ namespace detail {
             {
                 if (stack_.back().is_object())
                 {
-                    switch (options_.object_object_line_splits())
+                    switch (object_object_line_splits_)
                     {
                         case line_split_kind::same_line:
                         case line_split_kind::new_line:
-                            if (column_ >= options_.line_length_limit())
+                            if (column_ >= line_length_limit_)
                             {
                                 break_line();
                             }
@@ -467,15 +484,15 @@ namespace detail {
                         default: // multi_line
                             break;
                     }
-                    stack_.emplace_back(container_type::object,options_.object_object_line_splits(), false,
+                    stack_.emplace_back(container_type::object,object_object_line_splits_, false,
                                         column_, column_+open_object_brace_str_.length());
                 }
                 else // array
                 {
-                    switch (options_.array_object_line_splits())
+                    switch (array_object_line_splits_)
                     {
                         case line_split_kind::same_line:
-                            if (column_ >= options_.line_length_limit())
+                            if (column_ >= line_length_limit_)
                             {
                                 //stack_.back().new_line_after(true);
                                 new_line();
@@ -490,7 +507,7 @@ namespace detail {
                             new_line();
                             break;
                     }
-                    stack_.emplace_back(container_type::object,options_.array_object_line_splits(), false,
+                    stack_.emplace_back(container_type::object,array_object_line_splits_, false,
                                         column_, column_+open_object_brace_str_.length());
                 }
             }
@@ -540,27 +557,27 @@ namespace detail {
             {
                 if (stack_.back().is_object())
                 {
-                    switch (options_.object_array_line_splits())
+                    switch (object_array_line_splits_)
                     {
                         case line_split_kind::same_line:
-                            stack_.emplace_back(container_type::array,options_.object_array_line_splits(),false,
+                            stack_.emplace_back(container_type::array,object_array_line_splits_,false,
                                                 column_, column_ + open_array_bracket_str_.length());
                             break;
                         case line_split_kind::new_line:
                         {
-                            stack_.emplace_back(container_type::array,options_.object_array_line_splits(),true,
+                            stack_.emplace_back(container_type::array,object_array_line_splits_,true,
                                                 column_, column_+open_array_bracket_str_.length());
                             break;
                         }
                         default: // multi_line
-                            stack_.emplace_back(container_type::array,options_.object_array_line_splits(),true,
+                            stack_.emplace_back(container_type::array,object_array_line_splits_,true,
                                                 column_, column_+open_array_bracket_str_.length());
                             break;
                     }
                 }
                 else // array
                 {
-                    switch (options_.array_array_line_splits())
+                    switch (array_array_line_splits_)
                     {
                         case line_split_kind::same_line:
                             if (stack_.back().is_multi_line())
@@ -568,19 +585,19 @@ namespace detail {
                                 stack_.back().new_line_after(true);
                                 new_line();
                             }
-                            stack_.emplace_back(container_type::array,options_.array_array_line_splits(), false,
+                            stack_.emplace_back(container_type::array,array_array_line_splits_, false,
                                                 column_, column_+open_array_bracket_str_.length());
                             break;
                         case line_split_kind::new_line:
                             stack_.back().new_line_after(true);
                             new_line();
-                            stack_.emplace_back(container_type::array,options_.array_array_line_splits(), false,
+                            stack_.emplace_back(container_type::array,array_array_line_splits_, false,
                                                 column_, column_+open_array_bracket_str_.length());
                             break;
                         default: // multi_line
                             stack_.back().new_line_after(true);
                             new_line();
-                            stack_.emplace_back(container_type::array,options_.array_array_line_splits(), false,
+                            stack_.emplace_back(container_type::array,array_array_line_splits_, false,
                                                 column_, column_+open_array_bracket_str_.length());
                             //new_line();
                             break;
@@ -629,7 +646,7 @@ namespace detail {
                 stack_.back().new_line_after(true);
                 new_line();
             }
-            else if (stack_.back().count() > 0 && column_ >= options_.line_length_limit())
+            else if (stack_.back().count() > 0 && column_ >= line_length_limit_)
             {
                 //stack_.back().new_line_after(true);
                 new_line(stack_.back().data_pos());
@@ -655,7 +672,7 @@ namespace detail {
                 {
                     begin_scalar_value();
                 }
-                if (!stack_.back().is_multi_line() && column_ >= options_.line_length_limit())
+                if (!stack_.back().is_multi_line() && column_ >= line_length_limit_)
                 {
                     break_line();
                 }
@@ -676,7 +693,7 @@ namespace detail {
                 {
                     begin_scalar_value();
                 }
-                if (!stack_.back().is_multi_line() && column_ >= options_.line_length_limit())
+                if (!stack_.back().is_multi_line() && column_ >= line_length_limit_)
                 {
                     break_line();
                 }
@@ -729,7 +746,7 @@ namespace detail {
                 {
                     begin_scalar_value();
                 }
-                if (!stack_.back().is_multi_line() && column_ >= options_.line_length_limit())
+                if (!stack_.back().is_multi_line() && column_ >= line_length_limit_)
                 {
                     break_line();
                 }
@@ -802,7 +819,7 @@ namespace detail {
                 {
                     begin_scalar_value();
                 }
-                if (!stack_.back().is_multi_line() && column_ >= options_.line_length_limit())
+                if (!stack_.back().is_multi_line() && column_ >= line_length_limit_)
                 {
                     break_line();
                 }
@@ -883,7 +900,7 @@ namespace detail {
                 {
                     begin_scalar_value();
                 }
-                if (!stack_.back().is_multi_line() && column_ >= options_.line_length_limit())
+                if (!stack_.back().is_multi_line() && column_ >= line_length_limit_)
                 {
                     break_line();
                 }
@@ -905,7 +922,7 @@ namespace detail {
                 {
                     begin_scalar_value();
                 }
-                if (!stack_.back().is_multi_line() && column_ >= options_.line_length_limit())
+                if (!stack_.back().is_multi_line() && column_ >= line_length_limit_)
                 {
                     break_line();
                 }
@@ -924,7 +941,7 @@ namespace detail {
                 {
                     begin_scalar_value();
                 }
-                if (!stack_.back().is_multi_line() && column_ >= options_.line_length_limit())
+                if (!stack_.back().is_multi_line() && column_ >= line_length_limit_)
                 {
                     break_line();
                 }
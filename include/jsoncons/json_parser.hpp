@@ -38,7 +38,129 @@ namespace jsoncons {
 
 namespace detail {
 
-}
+    // Returns a pointer to the first line terminator ('\r' or '\n') in
+    // [first,last), or last if there is none. char_traits::find lowers to
+    // memchr for narrow characters, which is vectorized in common C libraries.
+
+    template <typename CharT>
+    inline
+    const CharT* scan_line_end(const CharT* first, const CharT* last) noexcept
+    {
+        const CharT* p = std::char_traits<CharT>::find(first, static_cast<std::size_t>(last-first), '\n');
+        const CharT* e = (p != nullptr) ? p : last;
+        const CharT* q = std::char_traits<CharT>::find(first, static_cast<std::size_t>(e-first), '\r');
+        return (q != nullptr) ? q : e;
+    }
+
+    // Returns a pointer to the first character in [first,last) that requires
+    // special handling inside a JSON string - '"', '\\', or a control
+    // character - or last if there is none.
+
+    template <typename CharT>
+    inline
+    const CharT* scan_string_special(const CharT* first, const CharT* last) noexcept
+    {
+        const CharT* p = first;
+        for (; p < last; ++p)
+        {
+            CharT c = *p;
+            if (c == '"' || c == '\\' || (c >= 0 && c < 0x20))
+            {
+                break;
+            }
+        }
+        return p;
+    }
+
+#if defined(JSONCONS_HAS_SSE2)
+
+    inline
+    uint32_t count_trailing_zeros(uint32_t x) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, x);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctz(x));
+#endif
+    }
+
+    inline
+    const char* scan_string_special(const char* first, const char* last) noexcept
+    {
+        const char* p = first;
+#if defined(JSONCONS_HAS_AVX512BW)
+        while (last - p >= 64)
+        {
+            if (last - p > 512)
+            {
+                _mm_prefetch(reinterpret_cast<const char*>(p + 512), _MM_HINT_T0);
+            }
+            __m512i block = _mm512_loadu_si512(reinterpret_cast<const void*>(p));
+            uint64_t mask = _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8('"'))
+                | _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8('\\'))
+                | _mm512_cmplt_epu8_mask(block, _mm512_set1_epi8(0x20));
+            if (mask != 0)
+            {
+#if defined(_MSC_VER)
+                unsigned long index;
+                _BitScanForward64(&index, mask);
+                return p + index;
+#else
+                return p + __builtin_ctzll(mask);
+#endif
+            }
+            p += 64;
+        }
+#endif
+#if defined(JSONCONS_HAS_AVX2)
+        while (last - p >= 32)
+        {
+            // Stay ahead of the loads; bounded so the hint never touches a
+            // page past the end of the input.
+            if (last - p > 512)
+            {
+                _mm_prefetch(reinterpret_cast<const char*>(p + 512), _MM_HINT_T0);
+            }
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            __m256i quotes = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('"'));
+            __m256i backslashes = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\'));
+            __m256i controls = _mm256_cmpeq_epi8(_mm256_subs_epu8(block, _mm256_set1_epi8(0x1f)),
+                _mm256_setzero_si256());
+            uint32_t mask = static_cast<uint32_t>(
+                _mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(quotes, backslashes), controls)));
+            if (mask != 0)
+            {
+                return p + count_trailing_zeros(mask);
+            }
+            p += 32;
+        }
+#endif
+        while (last - p >= 16)
+        {
+            if (last - p > 512)
+            {
+                _mm_prefetch(reinterpret_cast<const char*>(p + 512), _MM_HINT_T0);
+            }
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i quotes = _mm_cmpeq_epi8(block, _mm_set1_epi8('"'));
+            __m128i backslashes = _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'));
+            __m128i controls = _mm_cmpeq_epi8(_mm_subs_epu8(block, _mm_set1_epi8(0x1f)), _mm_setzero_si128());
+            uint32_t mask = static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(quotes, backslashes), controls)));
+            if (mask != 0)
+            {
+                return p + count_trailing_zeros(mask);
+            }
+            p += 16;
+        }
+        return scan_string_special<char>(p, last);
+    }
+
+#endif // defined(JSONCONS_HAS_SSE2)
+
+} // namespace detail
 
 enum class parse_state : uint8_t 
 {
@@ -1597,15 +1719,12 @@ public:
                 }
                 case parse_state::slash_slash: 
                 {
-                    switch (*input_ptr_)
+                    const char_type* p = detail::scan_line_end(input_ptr_, local_input_end);
+                    position_ += static_cast<std::size_t>(p - input_ptr_);
+                    input_ptr_ = p;
+                    if (input_ptr_ != local_input_end)
                     {
-                    case '\r':
-                    case '\n':
                         state_ = pop_state();
-                        break;
-                    default:
-                        ++input_ptr_;
-                        ++position_;
                     }
                     break;
                 }
@@ -2183,6 +2302,11 @@ exp3:
 text:
         while (input_ptr_ < local_input_end)
         {
+            input_ptr_ = detail::scan_string_special(input_ptr_, local_input_end);
+            if (JSONCONS_UNLIKELY(input_ptr_ == local_input_end))
+            {
+                break;
+            }
             switch (*input_ptr_)
             {
                 JSONCONS_ILLEGAL_CONTROL_CHARACTER:
@@ -7,6 +7,7 @@
 #ifndef JSONCONS_SOURCE_HPP
 #define JSONCONS_SOURCE_HPP
 
+#include <algorithm> // std::copy_n, std::min
 #include <cstdint>
 #include <cstring> // std::memcpy
 #include <exception>
@@ -81,17 +82,17 @@ namespace jsoncons {
         static constexpr std::size_t default_max_buffer_size = 16384;
     private:
         using char_type = typename std::conditional<sizeof(CharT) == sizeof(char),char,CharT>::type;
-        basic_null_istream<char_type> null_is_;
         std::basic_istream<char_type>* stream_ptr_;
         std::basic_streambuf<char_type>* sbuf_;
         std::size_t position_{0};
         std::vector<value_type> buffer_;
         const value_type* buffer_data_;
         std::size_t buffer_length_{0};
+        bool eof_{false};
     public:
 
         stream_source()
-            : stream_ptr_(&null_is_), sbuf_(null_is_.rdbuf()),
+            : stream_ptr_(&null_stream()), sbuf_(null_stream().rdbuf()),
               buffer_(1), buffer_data_(buffer_.data())
         {
         }
@@ -100,17 +101,19 @@ namespace jsoncons {
         stream_source(const stream_source&) = delete;
 
         stream_source(stream_source&& other) noexcept
-            : stream_ptr_(&null_is_), sbuf_(null_is_.rdbuf()),
+            : stream_ptr_(&null_stream()), sbuf_(null_stream().rdbuf()),
               buffer_(), buffer_data_(buffer_.data())
         {
-            if (other.stream_ptr_ != &other.null_is_)
+            if (other.stream_ptr_ != &null_stream())
             {
                 stream_ptr_ = other.stream_ptr_;
                 sbuf_ = other.sbuf_;
                 position_ = other.position_;
+                std::size_t offset = static_cast<std::size_t>(other.buffer_data_ - other.buffer_.data());
                 buffer_ = std::move(other.buffer_);
-                buffer_data_ = buffer_.data() + (other.buffer_data_ - other.buffer_.data());
+                buffer_data_ = buffer_.data() + offset;
                 buffer_length_ =  other.buffer_length_;
+                eof_ = other.eof_;
                 other = stream_source();
             }
         }
@@ -127,38 +130,41 @@ namespace jsoncons {
 
         stream_source& operator=(stream_source&& other) noexcept
         {
-            if (other.stream_ptr_ != &other.null_is_)
+            if (other.stream_ptr_ != &null_stream())
             {
                 stream_ptr_ = other.stream_ptr_;
                 sbuf_ = other.sbuf_;
                 position_ = other.position_;
+                std::size_t offset = static_cast<std::size_t>(other.buffer_data_ - other.buffer_.data());
                 buffer_ = std::move(other.buffer_);
-                buffer_data_ = buffer_.data() + (other.buffer_data_ - other.buffer_.data());
+                buffer_data_ = buffer_.data() + offset;
                 buffer_length_ =  other.buffer_length_;
+                eof_ = other.eof_;
                 other = stream_source();
             }
             else
             {
-                stream_ptr_ = &null_is_;
-                sbuf_ = null_is_.rdbuf();
+                stream_ptr_ = &null_stream();
+                sbuf_ = null_stream().rdbuf();
                 position_ = 0;
                 buffer_data_ = buffer_.data();
                 buffer_length_ =  0;
+                eof_ = false;
             }
             return *this;
         }
 
-        bool eof() const
+        JSONCONS_FORCEINLINE bool eof() const noexcept
         {
-            return buffer_length_ == 0 && stream_ptr_->eof();
+            return buffer_length_ == 0 && eof_;
         }
 
-        bool is_error() const
+        bool is_error() const noexcept
         {
             return stream_ptr_->bad();  
         }
 
-        std::size_t position() const
+        JSONCONS_FORCEINLINE std::size_t position() const noexcept
         {
             return position_;
         }
@@ -173,6 +179,25 @@ namespace jsoncons {
                 buffer_data_ += len;
                 buffer_length_ -= len;
             }
+            if (len < length && length - len >= buffer_.size())
+            {
+                // For long skips a single seek replaces repeated buffer fills.
+                // Not all stream buffers are seekable (e.g. pipes), so fall
+                // through to the fill loop if the seek fails.
+                JSONCONS_TRY
+                {
+                    auto pos = sbuf_->pubseekoff(static_cast<std::streamoff>(length-len),
+                        std::ios_base::cur, std::ios_base::in);
+                    if (static_cast<std::streamoff>(pos) != std::streamoff(-1))
+                    {
+                        position_ += (length - len);
+                        return;
+                    }
+                }
+                JSONCONS_CATCH(const std::exception&)
+                {
+                }
+            }
             while (len < length)
             {
                 fill_buffer();
@@ -188,12 +213,16 @@ namespace jsoncons {
             }
         }
 
-        char_result<value_type> peek() 
+        // peek() and get() vend from [buffer_data_, buffer_data_+buffer_length_),
+        // the window filled by the last sgetn, so the streambuf's virtual
+        // interface is only crossed once per buffer fill, not per character.
+        char_result<value_type> peek()
         {
-            if (buffer_length_ == 0)
+            if (JSONCONS_LIKELY(buffer_length_ > 0))
             {
-                fill_buffer();
+                return char_result<value_type>{*buffer_data_, false};
             }
+            fill_buffer();
             if (buffer_length_ > 0)
             {
                 value_type c = *buffer_data_;
@@ -205,6 +234,23 @@ namespace jsoncons {
             }
         }
 
+        char_result<value_type> get()
+        {
+            if (JSONCONS_UNLIKELY(buffer_length_ == 0))
+            {
+                fill_buffer();
+                if (buffer_length_ == 0)
+                {
+                    return char_result<value_type>{0, true};
+                }
+            }
+            value_type c = *buffer_data_;
+            ++buffer_data_;
+            --buffer_length_;
+            ++position_;
+            return char_result<value_type>{c, false};
+        }
+
         span<const value_type> read_buffer() 
         {
             if (buffer_length_ == 0)
@@ -251,7 +297,7 @@ namespace jsoncons {
             }
             else
             {
-                if (stream_ptr_->eof())
+                if (eof_)
                 {
                     buffer_length_ = 0;
                     return 0;
@@ -262,6 +308,7 @@ namespace jsoncons {
                     std::size_t len2 = static_cast<std::size_t>(count);
                     if (len2 < length-len)
                     {
+                        eof_ = true;
                         stream_ptr_->clear(stream_ptr_->rdstate() | std::ios::eofbit);
                     }
                     len += len2;
@@ -270,15 +317,25 @@ namespace jsoncons {
                 }
                 JSONCONS_CATCH(const std::exception&)     
                 {
+                    eof_ = true;
                     stream_ptr_->clear(stream_ptr_->rdstate() | std::ios::badbit | std::ios::eofbit);
                     return 0;
                 }
             }
         }
     private:
+        // Shared sentinel for default-constructed and moved-from sources;
+        // avoids embedding a full null stream (streambuf included) in every
+        // instance.
+        static basic_null_istream<char_type>& null_stream()
+        {
+            static basic_null_istream<char_type> instance;
+            return instance;
+        }
+
         void fill_buffer()
         {
-            if (stream_ptr_->eof())
+            if (eof_)
             {
                 buffer_length_ = 0;
                 return;
@@ -292,87 +349,91 @@ namespace jsoncons {
 
                 if (buffer_length_ < buffer_.size())
                 {
+                    eof_ = true;
                     stream_ptr_->clear(stream_ptr_->rdstate() | std::ios::eofbit);
                 }
             }
             JSONCONS_CATCH(const std::exception&)     
             {
+                eof_ = true;
                 stream_ptr_->clear(stream_ptr_->rdstate() | std::ios::badbit | std::ios::eofbit);
                 buffer_length_ = 0;
             }
         }
     };
 
-    // string_source
+    // contiguous_source_base
+    //
+    // Shared state and cursor operations for the in-memory sources
+    // (string_source, bytes_source). One implementation keeps the inlined
+    // copies in parser hot loops identical across source types.
 
-    template <typename CharT>
-    class string_source 
+    template <typename T>
+    class contiguous_source_base
     {
     public:
-        using value_type = CharT;
-        using string_view_type = jsoncons::basic_string_view<value_type>;
+        using value_type = T;
     private:
         const value_type* data_;
         const value_type* current_;
         const value_type* end_;
-    public:
-        string_source()
+    protected:
+        contiguous_source_base()
             : data_(nullptr), current_(nullptr), end_(nullptr)
         {
         }
 
-        // Noncopyable 
-        string_source(const string_source&) = delete;
+        contiguous_source_base(const value_type* data, std::size_t length)
+            : data_(data), current_(data), end_(data+length)
+        {
+        }
 
-        string_source(string_source&& other) = default;
+        contiguous_source_base(contiguous_source_base&&) = default;
+        contiguous_source_base& operator=(contiguous_source_base&&) = default;
+        ~contiguous_source_base() = default;
+    public:
+        // Noncopyable 
+        contiguous_source_base(const contiguous_source_base&) = delete;
+        contiguous_source_base& operator=(const contiguous_source_base&) = delete;
 
-        template <typename Sourceable>
-        string_source(const Sourceable& s,
-                      typename std::enable_if<extension_traits::is_sequence_of<Sourceable,value_type>::value>::type* = 0)
-            : data_(s.data()), current_(s.data()), end_(s.data()+s.size())
+        JSONCONS_FORCEINLINE bool eof() const noexcept
         {
+            // EOF is derived from the cursor itself; keeping no separate flag
+            // means the fast paths store nothing extra to signal end of input.
+            return current_ >= end_;  
         }
 
-        string_source(const value_type* data)
-            : data_(data), current_(data), end_(data+std::char_traits<value_type>::length(data))
+        JSONCONS_FORCEINLINE bool is_error() const noexcept
         {
+            return false;  
         }
 
-        string_source& operator=(const string_source&) = delete;
-        string_source& operator=(string_source&& other) = default;
-
-        bool eof() const
+        JSONCONS_FORCEINLINE std::size_t position() const noexcept
         {
-            return current_ == end_;  
+            // current_ and data_ are value_type pointers, so the difference
+            // is already a count of characters, not bytes.
+            return static_cast<std::size_t>(current_ - data_);
         }
 
-        bool is_error() const
+        JSONCONS_FORCEINLINE void ignore(std::size_t count) noexcept
         {
-            return false;  
+            std::size_t len = (std::min)(static_cast<std::size_t>(end_ - current_), count);
+            current_ += len;
         }
 
-        std::size_t position() const
+        JSONCONS_FORCEINLINE char_result<value_type> peek() noexcept
         {
-            return (current_ - data_)/sizeof(value_type);
+            return current_ < end_ ? char_result<value_type>{*current_, false} : char_result<value_type>{0, true};
         }
 
-        void ignore(std::size_t count)
+        JSONCONS_FORCEINLINE char_result<value_type> get() noexcept
         {
-            std::size_t len;
-            if (std::size_t(end_ - current_) < count)
-            {
-                len = end_ - current_;
-            }
-            else
-            {
-                len = count;
-            }
-            current_ += len;
+            return JSONCONS_LIKELY(current_ < end_) ? char_result<value_type>{*current_++, false} : char_result<value_type>{0, true};
         }
 
-        char_result<value_type> peek() 
+        span<const value_type> view() const noexcept
         {
-            return current_ < end_ ? char_result<value_type>{*current_, false} : char_result<value_type>{0, true};
+            return span<const value_type>(current_, static_cast<std::size_t>(end_ - current_));
         }
 
         span<const value_type> read_buffer() 
@@ -386,21 +447,46 @@ namespace jsoncons {
 
         std::size_t read(value_type* p, std::size_t length)
         {
-            std::size_t len;
-            if (std::size_t(end_ - current_) < length)
-            {
-                len = end_ - current_;
-            }
-            else
-            {
-                len = length;
-            }
+            std::size_t len = (std::min)(static_cast<std::size_t>(end_ - current_), length);
             std::memcpy(p, current_, len*sizeof(value_type));
             current_  += len;
             return len;
         }
     };
 
+    // string_source
+
+    template <typename CharT>
+    class string_source : public contiguous_source_base<CharT>
+    {
+        using super_type = contiguous_source_base<CharT>;
+    public:
+        using value_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<value_type>;
+
+        string_source() = default;
+
+        // Noncopyable 
+        string_source(const string_source&) = delete;
+
+        string_source(string_source&& other) = default;
+
+        template <typename Sourceable>
+        string_source(const Sourceable& s,
+                      typename std::enable_if<extension_traits::is_sequence_of<Sourceable,value_type>::value>::type* = 0)
+            : super_type(s.data(), s.size())
+        {
+        }
+
+        string_source(const value_type* data)
+            : super_type(data, std::char_traits<value_type>::length(data))
+        {
+        }
+
+        string_source& operator=(const string_source&) = delete;
+        string_source& operator=(string_source&& other) = default;
+    };
+
     // iterator source
 
     template <typename IteratorT>
@@ -436,22 +522,33 @@ namespace jsoncons {
         iterator_source& operator=(const iterator_source&) = delete;
         iterator_source& operator=(iterator_source&& other) = default;
 
-        bool eof() const
+        JSONCONS_FORCEINLINE bool eof() const noexcept
         {
             return !(current_ != end_);  
         }
 
-        bool is_error() const
+        JSONCONS_FORCEINLINE bool is_error() const noexcept
         {
             return false;  
         }
 
-        std::size_t position() const
+        JSONCONS_FORCEINLINE std::size_t position() const noexcept
         {
             return position_;
         }
 
-        void ignore(std::size_t count)
+        template <typename Category = iterator_category>
+        typename std::enable_if<std::is_same<Category,std::random_access_iterator_tag>::value>::type
+        ignore(std::size_t count)
+        {
+            std::size_t len = (std::min)(count, static_cast<std::size_t>(std::distance(current_, end_)));
+            current_ += len;
+            position_ += len;
+        }
+
+        template <typename Category = iterator_category>
+        typename std::enable_if<!std::is_same<Category,std::random_access_iterator_tag>::value>::type
+        ignore(std::size_t count)
         {
             while (count-- > 0 && current_ != end_)
             {
@@ -465,6 +562,18 @@ namespace jsoncons {
             return current_ != end_ ? char_result<value_type>{*current_, false} : char_result<value_type>{0, true};
         }
 
+        char_result<value_type> get()
+        {
+            if (JSONCONS_LIKELY(current_ != end_))
+            {
+                value_type c = *current_;
+                ++current_;
+                ++position_;
+                return char_result<value_type>{c, false};
+            }
+            return char_result<value_type>{0, true};
+        }
+
         span<const value_type> read_buffer() 
         {
             if (buffer_length_ == 0)
@@ -483,16 +592,10 @@ namespace jsoncons {
         {
             std::size_t count = (std::min)(length, static_cast<std::size_t>(std::distance(current_, end_)));
 
-            //JSONCONS_COPY(current_, current_ + count, data);
-
-            auto end = current_ + count;
-            value_type* p = data;
-            while (current_ != end)
-            {
-                *p++ = *current_++;
-            }
-
-            //current_ += count;
+            // std::copy_n lowers to memmove for contiguous iterators and
+            // remains well-defined for non-contiguous random access ones.
+            std::copy_n(current_, count, data);
+            current_ += count;
             position_ += count;
 
             return count;
@@ -522,19 +625,13 @@ namespace jsoncons {
 
     using binary_stream_source = stream_source<uint8_t>;
 
-    class bytes_source 
+    class bytes_source : public contiguous_source_base<uint8_t>
     {
+        using super_type = contiguous_source_base<uint8_t>;
     public:
-        typedef uint8_t value_type;
-    private:
-        const value_type* data_;
-        const value_type* current_;
-        const value_type* end_;
-    public:
-        bytes_source()
-            : data_(nullptr), current_(nullptr), end_(nullptr)
-        {
-        }
+        using value_type = uint8_t;
+
+        bytes_source() = default;
 
         // Noncopyable 
         bytes_source(const bytes_source&) = delete;
@@ -544,73 +641,12 @@ namespace jsoncons {
         template <typename Sourceable>
         bytes_source(const Sourceable& source,
                      typename std::enable_if<extension_traits::is_byte_sequence<Sourceable>::value,int>::type = 0)
-            : data_(reinterpret_cast<const value_type*>(source.data())), 
-              current_(data_), 
-              end_(data_+source.size())
+            : super_type(reinterpret_cast<const value_type*>(source.data()), source.size())
         {
         }
 
         bytes_source& operator=(const bytes_source&) = delete;
         bytes_source& operator=(bytes_source&&) = default;
-
-        bool eof() const
-        {
-            return current_ == end_;  
-        }
-
-        bool is_error() const
-        {
-            return false;  
-        }
-
-        std::size_t position() const
-        {
-            return current_ - data_;
-        }
-
-        void ignore(std::size_t count)
-        {
-            std::size_t len;
-            if (std::size_t(end_ - current_) < count)
-            {
-                len = end_ - current_;
-            }
-            else
-            {
-                len = count;
-            }
-            current_ += len;
-        }
-
-        char_result<value_type> peek() 
-        {
-            return current_ < end_ ? char_result<value_type>{*current_, false} : char_result<value_type>{0, true};
-        }
-
-        span<const value_type> read_buffer() 
-        {
-            const value_type* data = current_;
-            std::size_t length = end_ - current_;
-            current_ = end_;
-
-            return span<const value_type>(data, length);
-        }
-
-        std::size_t read(value_type* p, std::size_t length)
-        {
-            std::size_t len;
-            if (std::size_t(end_ - current_) < length)
-            {
-                len = end_ - current_;
-            }
-            else
-            {
-                len = length;
-            }
-            std::memcpy(p, current_, len*sizeof(value_type));
-            current_  += len;
-            return len;
-        }
     };
 
     // binary_iterator source
@@ -646,22 +682,33 @@ namespace jsoncons {
         binary_iterator_source& operator=(const binary_iterator_source&) = delete;
         binary_iterator_source& operator=(binary_iterator_source&& other) = default;
 
-        bool eof() const
+        JSONCONS_FORCEINLINE bool eof() const noexcept
         {
             return !(current_ != end_);  
         }
 
-        bool is_error() const
+        JSONCONS_FORCEINLINE bool is_error() const noexcept
         {
             return false;  
         }
 
-        std::size_t position() const
+        JSONCONS_FORCEINLINE std::size_t position() const noexcept
         {
             return position_;
         }
 
-        void ignore(std::size_t count)
+        template <typename Category = iterator_category>
+        typename std::enable_if<std::is_same<Category,std::random_access_iterator_tag>::value>::type
+        ignore(std::size_t count)
+        {
+            std::size_t len = (std::min)(count, static_cast<std::size_t>(std::distance(current_, end_)));
+            current_ += len;
+            position_ += len;
+        }
+
+        template <typename Category = iterator_category>
+        typename std::enable_if<!std::is_same<Category,std::random_access_iterator_tag>::value>::type
+        ignore(std::size_t count)
         {
             while (count-- > 0 && current_ != end_)
             {
@@ -675,6 +722,18 @@ namespace jsoncons {
             return current_ != end_ ? char_result<value_type>{static_cast<value_type>(*current_), false} : char_result<value_type>{0, true};
         }
 
+        char_result<value_type> get()
+        {
+            if (JSONCONS_LIKELY(current_ != end_))
+            {
+                value_type c = static_cast<value_type>(*current_);
+                ++current_;
+                ++position_;
+                return char_result<value_type>{c, false};
+            }
+            return char_result<value_type>{0, true};
+        }
+
         span<const value_type> read_buffer() 
         {
             if (buffer_length_ == 0)
@@ -692,16 +751,11 @@ namespace jsoncons {
         read(value_type* data, std::size_t length)
         {
             std::size_t count = (std::min)(length, static_cast<std::size_t>(std::distance(current_, end_)));
-            //JSONCONS_COPY(current_, current_ + count, data);
 
-            auto end = current_ + count;
-            value_type* p = data;
-            while (current_ != end)
-            {
-                *p++ = *current_++;
-            }
-
-            //current_ += count;
+            // std::copy_n lowers to memmove for contiguous iterators and
+            // remains well-defined for non-contiguous random access ones.
+            std::copy_n(current_, count, data);
+            current_ += count;
             position_ += count;
 
             return count;
@@ -727,28 +781,58 @@ namespace jsoncons {
         }
     };
 
+    // is_contiguous_source
+
     template <typename Source>
+    using source_view_t = decltype(std::declval<Source>().view());
+
+    template <typename Source>
+    using is_contiguous_source = extension_traits::is_detected<source_view_t, Source>;
+
+    template <typename Source,std::size_t MaxBufferLength = 16384>
     struct source_reader
     {
         using value_type = typename Source::value_type;
-        static constexpr std::size_t max_buffer_length = 16384;
+        static constexpr std::size_t max_buffer_length = MaxBufferLength;
 
+        // Contiguous in-memory sources expose the unread data directly, so a
+        // single insert replaces the chunked resize+read loop.
         template <typename Container>
         static
         typename std::enable_if<std::is_convertible<value_type,typename Container::value_type>::value &&
+                                is_contiguous_source<Source>::value 
+     , std::size_t>::type
+        read(Source& source, Container& v, std::size_t length)
+        {
+            auto s = source.view();
+            std::size_t len = (std::min)(s.size(), length);
+            v.insert(v.end(), s.data(), s.data()+len);
+            source.ignore(len);
+            return len;
+        }
+
+        template <typename Container>
+        static
+        typename std::enable_if<std::is_convertible<value_type,typename Container::value_type>::value &&
+                                !is_contiguous_source<Source>::value &&
                                 extension_traits::has_reserve<Container>::value &&
                                 extension_traits::has_data_exact<value_type*,Container>::value 
      , std::size_t>::type
         read(Source& source, Container& v, std::size_t length)
         {
+            if (JSONCONS_LIKELY(length <= max_buffer_length))
+            {
+                // Single-chunk case (short strings and byte strings dominate):
+                // no loop, and the container is trimmed to what was actually read.
+                return append_read(source, v, length);
+            }
+
             std::size_t unread = length;
 
             std::size_t n = (std::min)(max_buffer_length, unread);
             while (n > 0 && !source.eof())
             {
-                std::size_t offset = v.size();
-                v.resize(v.size()+n);
-                std::size_t actual = source.read(v.data()+offset, n);
+                std::size_t actual = append_read(source, v, n);
                 unread -= actual;
                 n = (std::min)(max_buffer_length, unread);
             }
@@ -756,9 +840,45 @@ namespace jsoncons {
             return length - unread;
         }
 
+    private:
+        // Appends up to n elements read from source. The basic_string overload
+        // uses resize_and_overwrite where the library provides it, so the new
+        // elements are not zero-filled before source.read overwrites them.
+#if defined(__cpp_lib_string_resize_and_overwrite)
+        template <typename Traits,typename A>
+        static std::size_t append_read(Source& source, std::basic_string<value_type,Traits,A>& v, std::size_t n)
+        {
+            std::size_t offset = v.size();
+            std::size_t actual = 0;
+            v.resize_and_overwrite(offset+n, 
+                [&](value_type* p, std::size_t) 
+                {
+                    actual = source.read(p+offset, n);
+                    return offset+actual;
+                });
+            return actual;
+        }
+#endif
+
+        template <typename Container>
+        static std::size_t append_read(Source& source, Container& v, std::size_t n)
+        {
+            std::size_t offset = v.size();
+            v.resize(offset+n);
+            std::size_t actual = source.read(v.data()+offset, n);
+            if (actual < n)
+            {
+                v.resize(offset+actual);
+            }
+            return actual;
+        }
+
+    public:
+
         template <typename Container>
         static
         typename std::enable_if<std::is_convertible<value_type,typename Container::value_type>::value &&
+                                !is_contiguous_source<Source>::value &&
                                 extension_traits::has_reserve<Container>::value &&
                                 !extension_traits::has_data_exact<value_type*, Container>::value 
      , std::size_t>::type
@@ -791,8 +911,8 @@ namespace jsoncons {
 #if __cplusplus >= 201703L
 // not needed for C++17
 #else
-    template <typename Source>
-    constexpr std::size_t source_reader<Source>::max_buffer_length;
+    template <typename Source,std::size_t MaxBufferLength>
+    constexpr std::size_t source_reader<Source,MaxBufferLength>::max_buffer_length;
 #endif
 
 } // namespace jsoncons
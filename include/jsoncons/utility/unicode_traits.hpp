@@ -179,7 +179,24 @@ namespace jsoncons { namespace unicode_traits {
         2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,4,4,4,4,5,5,5,5
     };
 
-    // Some fundamental constants.  Source: ConvertUTF.h 
+    // Number of continuation bytes that are supposed to follow a lead byte,
+    // computed from its count of leading one bits. Matches
+    // trailing_bytes_for_utf8 for every value without the table load.
+    inline unsigned trailing_bytes_for_lead(uint8_t lead) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        if (lead < 0x80)
+        {
+            return 0;
+        }
+        unsigned n = static_cast<unsigned>(__builtin_clz(~(static_cast<uint32_t>(lead) << 24))) - 1;
+        return n > 5 ? 5 : n;
+#else
+        return trailing_bytes_for_utf8[lead];
+#endif
+    }
+
+    // Some fundamental constants.  Source: ConvertUTF.h
     const uint32_t replacement_char = 0x0000FFFD;
     const uint32_t max_bmp = 0x0000FFFF;
     const uint32_t max_utf16 = 0x0010FFFF;
@@ -195,28 +212,28 @@ namespace jsoncons { namespace unicode_traits {
     const uint16_t sur_low_start = 0xDC00;
     const uint16_t sur_low_end = 0xDFFF;
 
-    inline
-    static bool is_continuation_byte(unsigned char ch)
+    // The range checks below use the single-compare form
+    // (ch - start) < count, which needs one subtraction instead of
+    // two comparisons and can be evaluated at compile time.
+
+    constexpr bool is_continuation_byte(unsigned char ch) noexcept
     {
         return (ch & 0xC0) == 0x80;
     }
 
-    inline
-    bool is_high_surrogate(uint32_t ch) noexcept
+    constexpr bool is_high_surrogate(uint32_t ch) noexcept
     {
-        return (ch >= sur_high_start && ch <= sur_high_end);
+        return (ch - sur_high_start) < 0x400u;
     }
 
-    inline
-    bool is_low_surrogate(uint32_t ch) noexcept
+    constexpr bool is_low_surrogate(uint32_t ch) noexcept
     {
-        return (ch >= sur_low_start && ch <= sur_low_end);
+        return (ch - sur_low_start) < 0x400u;
     }
 
-    inline
-    bool is_surrogate(uint32_t ch) noexcept
+    constexpr bool is_surrogate(uint32_t ch) noexcept
     {
-        return (ch >= sur_high_start && ch <= sur_low_end);
+        return (ch - sur_high_start) < 0x800u;
     }
 
     enum class conv_flags 
@@ -296,9 +313,54 @@ namespace jsoncons { namespace unicode_traits {
 
     // utf8
 
+    /*
+     * Smallest and largest legal second byte of a multi-byte UTF-8
+     * sequence, indexed by the lead byte. Every entry is 0x80..0xBF
+     * except the E0/ED/F0/F4 rows, which carry the special cases of
+     * Table 3-7 of the Unicode Standard (overlong forms, surrogates,
+     * and codepoints beyond U+10FFFF).
+     */
+    const uint8_t utf8_second_byte_min[256] = {
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0xA0,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,
+        0x90,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80
+    };
+
+    const uint8_t utf8_second_byte_max[256] = {
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0x9F,0xBF,0xBF,
+        0xBF,0xBF,0xBF,0xBF,0x8F,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF,0xBF
+    };
+
     template <typename CharT>
     typename std::enable_if<extension_traits::is_char8<CharT>::value, conv_errc>::type
-    is_legal_utf8(const CharT* first, std::size_t length) 
+    is_legal_utf8(const CharT* first, std::size_t length)
     {
         uint8_t a;
         const CharT* srcptr = first+length;
@@ -317,15 +379,9 @@ namespace jsoncons { namespace unicode_traits {
             if (((a = (*--srcptr))& 0xC0) != 0x80)
                 return conv_errc::expected_continuation_byte;
 
-            switch (static_cast<uint8_t>(*first)) 
-            {
-                // no fall-through in this inner switch
-                case 0xE0: if (a < 0xA0) return conv_errc::source_illegal; break;
-                case 0xED: if (a > 0x9F) return conv_errc::source_illegal; break;
-                case 0xF0: if (a < 0x90) return conv_errc::source_illegal; break;
-                case 0xF4: if (a > 0x8F) return conv_errc::source_illegal; break;
-                default:   if (a < 0x80) return conv_errc::source_illegal;
-            }
+            if (a < utf8_second_byte_min[static_cast<uint8_t>(*first)] ||
+                a > utf8_second_byte_max[static_cast<uint8_t>(*first)])
+                return conv_errc::source_illegal;
 
             JSONCONS_FALLTHROUGH;
         case 1:
@@ -389,7 +445,7 @@ namespace jsoncons { namespace unicode_traits {
         }
         conv_errc  result = conv_errc();
 
-        unsigned short extra_bytes_to_read = trailing_bytes_for_utf8[static_cast<uint8_t>(*first)];
+        unsigned short extra_bytes_to_read = static_cast<unsigned short>(trailing_bytes_for_lead(static_cast<uint8_t>(*first)));
         if (extra_bytes_to_read >= last - first) 
         {
             result = conv_errc::source_exhausted; 
@@ -401,17 +457,11 @@ namespace jsoncons { namespace unicode_traits {
             return convert_result<CharT>{first, result};
         }
         // The cases all fall through. See "Note A" below.
-        switch (extra_bytes_to_read) 
+        // is_legal_utf8 has rejected the overlong 5- and 6-byte forms,
+        // so at most 3 continuation bytes remain.
+        switch (extra_bytes_to_read)
         {
-            case 5: 
-                ch += static_cast<uint8_t>(*first++); 
-                ch <<= 6;
-                JSONCONS_FALLTHROUGH;
-            case 4: 
-                ch += static_cast<uint8_t>(*first++); 
-                ch <<= 6;
-                JSONCONS_FALLTHROUGH;
-            case 3: 
+            case 3:
                 ch += static_cast<uint8_t>(*first++); 
                 ch <<= 6;
                 JSONCONS_FALLTHROUGH;
@@ -546,22 +596,122 @@ namespace jsoncons { namespace unicode_traits {
         return convert_result<CharT>{first,result} ;
     }
 
+    // skip_ascii
+
+    // Advances ptr over a leading run of ASCII characters, 16 bytes at a time
+    // where SIMD is available and 8 bytes at a time otherwise, returning the
+    // number of characters skipped. ASCII characters are one codepoint each,
+    // so the decode loop only has to run on non-ASCII sequences.
+
+    template <typename CharT>
+    inline
+    typename std::enable_if<extension_traits::is_char8<CharT>::value, std::size_t>::type
+    skip_ascii(const CharT*& ptr, const CharT* last) noexcept
+    {
+        const CharT* first = ptr;
+#if defined(JSONCONS_HAS_SSE2)
+        while (last - ptr >= 16)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            if (_mm_movemask_epi8(block) != 0)
+            {
+                break;
+            }
+            ptr += 16;
+        }
+#endif
+        while (last - ptr >= 8)
+        {
+            uint64_t chunk;
+            std::memcpy(&chunk, ptr, sizeof(chunk));
+            if ((chunk & UINT64_C(0x8080808080808080)) != 0)
+            {
+                break;
+            }
+            ptr += 8;
+        }
+        while (ptr < last && static_cast<uint8_t>(*ptr) < 0x80)
+        {
+            ++ptr;
+        }
+        return static_cast<std::size_t>(ptr - first);
+    }
+
+    // As above, for UTF-16 code units: advances ptr over a leading run of
+    // units below 0x80, which encode as single bytes and can never be
+    // surrogates, 8 units at a time where SIMD is available and 4 at a time
+    // otherwise.
+
+    template <typename CharT>
+    inline
+    typename std::enable_if<extension_traits::is_char16<CharT>::value, std::size_t>::type
+    skip_ascii(const CharT*& ptr, const CharT* last) noexcept
+    {
+        const CharT* first = ptr;
+#if defined(JSONCONS_HAS_SSE2)
+        while (last - ptr >= 8)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            __m128i high = _mm_and_si128(block, _mm_set1_epi16(static_cast<short>(0xFF80)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+            ptr += 8;
+        }
+#endif
+        while (last - ptr >= 4)
+        {
+            uint64_t chunk;
+            std::memcpy(&chunk, ptr, sizeof(chunk));
+            if ((chunk & UINT64_C(0xFF80FF80FF80FF80)) != 0)
+            {
+                break;
+            }
+            ptr += 4;
+        }
+        while (ptr < last && static_cast<uint16_t>(*ptr) < 0x80)
+        {
+            ++ptr;
+        }
+        return static_cast<std::size_t>(ptr - first);
+    }
+
+    // Asks the target for capacity up front when it supports reserve, so the
+    // push_back loops in the converters don't grow it step by step. The hint
+    // is the source length: exact for same-width copies and ASCII, and a
+    // bound on the output size otherwise.
+
+    template <typename Container>
+    typename std::enable_if<extension_traits::has_reserve<Container>::value>::type
+    reserve_hint(Container& target, std::size_t n)
+    {
+        target.reserve(target.size() + n);
+    }
+
+    template <typename Container>
+    typename std::enable_if<!extension_traits::has_reserve<Container>::value>::type
+    reserve_hint(Container&, std::size_t)
+    {
+    }
+
     // convert
 
     template <typename CharT,typename Container>
     typename std::enable_if<extension_traits::is_char8<CharT>::value
                             && extension_traits::is_back_insertable<Container>::value
                             && extension_traits::is_char8<typename Container::value_type>::value,
-                            convert_result<CharT>>::type 
-    convert(const CharT* data, std::size_t length, Container& target, conv_flags flags=conv_flags::strict) 
+                            convert_result<CharT>>::type
+    convert(const CharT* data, std::size_t length, Container& target, conv_flags flags=conv_flags::strict)
     {
+        reserve_hint(target, length);
         (void)flags;
 
         conv_errc  result = conv_errc();
         const CharT* last = data + length;
         while (data != last) 
         {
-            std::size_t len = trailing_bytes_for_utf8[static_cast<uint8_t>(*data)] + 1;
+            std::size_t len = trailing_bytes_for_lead(static_cast<uint8_t>(*data)) + 1;
             if (len > (std::size_t)(last - data))
             {
                 return convert_result<CharT>{data, conv_errc::source_exhausted};
@@ -593,15 +743,28 @@ namespace jsoncons { namespace unicode_traits {
             Container& target, 
             conv_flags flags = conv_flags::strict) 
     {
+        reserve_hint(target, length);
         conv_errc  result = conv_errc();
 
         const CharT* last = data + length;
-        while (data != last) 
+        while (data != last)
         {
-            unsigned short extra_bytes_to_read = trailing_bytes_for_utf8[static_cast<uint8_t>(*data)];
-            if (extra_bytes_to_read >= last - data) 
+            // ASCII bytes map to single code units unchanged; copy whole runs
+            // without running the multi-byte decoder.
+            const CharT* run = data;
+            skip_ascii(data, last);
+            for (; run != data; ++run)
+            {
+                target.push_back(static_cast<uint8_t>(*run));
+            }
+            if (data == last)
+            {
+                break;
+            }
+            unsigned short extra_bytes_to_read = static_cast<unsigned short>(trailing_bytes_for_lead(static_cast<uint8_t>(*data)));
+            if (extra_bytes_to_read >= last - data)
             {
-                result = conv_errc::source_exhausted; 
+                result = conv_errc::source_exhausted;
                 break;
             }
             /* Do this check whether lenient or strict */
@@ -611,13 +774,11 @@ namespace jsoncons { namespace unicode_traits {
             }
             /*
              * The cases all fall through. See "Note A" below.
+             * is_legal_utf8 has rejected the overlong 5- and 6-byte forms,
+             * so at most 3 continuation bytes remain.
              */
             uint32_t ch = 0;
             switch (extra_bytes_to_read) {
-                case 5: ch += static_cast<uint8_t>(*data++); ch <<= 6; /* remember, illegal UTF-8 */
-                    JSONCONS_FALLTHROUGH;
-                case 4: ch += static_cast<uint8_t>(*data++); ch <<= 6; /* remember, illegal UTF-8 */
-                    JSONCONS_FALLTHROUGH;
                 case 3: ch += static_cast<uint8_t>(*data++); ch <<= 6;
                     JSONCONS_FALLTHROUGH;
                 case 2: ch += static_cast<uint8_t>(*data++); ch <<= 6;
@@ -670,16 +831,29 @@ namespace jsoncons { namespace unicode_traits {
             Container& target, 
             conv_flags flags = conv_flags::strict) 
     {
+        reserve_hint(target, length);
         conv_errc  result = conv_errc();
 
         const CharT* last = data + length;
-        while (data < last) 
+        while (data < last)
         {
+            // ASCII bytes map to single code units unchanged; copy whole runs
+            // without running the multi-byte decoder.
+            const CharT* run = data;
+            skip_ascii(data, last);
+            for (; run != data; ++run)
+            {
+                target.push_back(static_cast<uint8_t>(*run));
+            }
+            if (data == last)
+            {
+                break;
+            }
             uint32_t ch = 0;
-            unsigned short extra_bytes_to_read = trailing_bytes_for_utf8[static_cast<uint8_t>(*data)];
-            if (extra_bytes_to_read >= last - data) 
+            unsigned short extra_bytes_to_read = static_cast<unsigned short>(trailing_bytes_for_lead(static_cast<uint8_t>(*data)));
+            if (extra_bytes_to_read >= last - data)
             {
-                result = conv_errc::source_exhausted; 
+                result = conv_errc::source_exhausted;
                 break;
             }
             /* Do this check whether lenient or strict */
@@ -689,18 +863,12 @@ namespace jsoncons { namespace unicode_traits {
             }
             /*
              * The cases all fall through. See "Note A" below.
+             * is_legal_utf8 has rejected the overlong 5- and 6-byte forms,
+             * so at most 3 continuation bytes remain.
              */
-            switch (extra_bytes_to_read) 
+            switch (extra_bytes_to_read)
             {
-                case 5: 
-                    ch += static_cast<uint8_t>(*data++); 
-                    ch <<= 6;
-                    JSONCONS_FALLTHROUGH;
-                case 4: 
-                    ch += static_cast<uint8_t>(*data++); 
-                    ch <<= 6;
-                    JSONCONS_FALLTHROUGH;
-                case 3: 
+                case 3:
                     ch += static_cast<uint8_t>(*data++); 
                     ch <<= 6;
                     JSONCONS_FALLTHROUGH;
@@ -755,14 +923,27 @@ namespace jsoncons { namespace unicode_traits {
                      conv_flags flags = conv_flags::strict) {
         conv_errc  result = conv_errc();
 
+        reserve_hint(target, length);
         const CharT* last = data + length;
         while (data < last) {
+            // ASCII code units encode as single bytes and are never
+            // surrogates; copy whole runs without classifying each unit.
+            const CharT* run = data;
+            skip_ascii(data, last);
+            for (; run != data; ++run)
+            {
+                target.push_back(static_cast<uint8_t>(*run));
+            }
+            if (data == last)
+            {
+                break;
+            }
             unsigned short bytes_to_write = 0;
             const uint32_t byteMask = 0xBF;
-            const uint32_t byteMark = 0x80; 
+            const uint32_t byteMark = 0x80;
             uint32_t ch = *data++;
             /* If we have a surrogate pair, convert to uint32_t data. */
-            if (is_high_surrogate(ch)) 
+            if (is_high_surrogate(ch))
             {
                 /* If the 16 bits following the high surrogate are in the data buffer... */
                 if (data < last) {
@@ -792,7 +973,7 @@ namespace jsoncons { namespace unicode_traits {
                 }
             }
             /* Figure out how many bytes the result will require */
-            if (ch < (uint32_t)0x80) {      
+            if (JSONCONS_LIKELY(ch < (uint32_t)0x80)) {
                 bytes_to_write = 1;
             } else if (ch < (uint32_t)0x800) {     
                 bytes_to_write = 2;
@@ -854,6 +1035,7 @@ namespace jsoncons { namespace unicode_traits {
             Container& target, 
             conv_flags flags = conv_flags::strict) 
     {
+        reserve_hint(target, length);
         conv_errc  result = conv_errc();
 
         const CharT* last = data + length;
@@ -911,6 +1093,7 @@ namespace jsoncons { namespace unicode_traits {
             Container& target, 
             conv_flags flags = conv_flags::strict) 
     {
+        reserve_hint(target, length);
         conv_errc  result = conv_errc();
 
         const CharT* last = data + length;
@@ -964,6 +1147,7 @@ namespace jsoncons { namespace unicode_traits {
             Container& target, 
             conv_flags flags = conv_flags::strict) 
     {
+        reserve_hint(target, length);
         conv_errc  result = conv_errc();
         const CharT* last = data + length;
         while (data < last) 
@@ -986,7 +1170,7 @@ namespace jsoncons { namespace unicode_traits {
              * Figure out how many bytes the result will require. Turn any
              * illegally large UTF32 things (> Plane 17) into replacement chars.
              */
-            if (ch < (uint32_t)0x80) {      bytes_to_write = 1;
+            if (JSONCONS_LIKELY(ch < (uint32_t)0x80)) {      bytes_to_write = 1;
             } else if (ch < (uint32_t)0x800) {     bytes_to_write = 2;
             } else if (ch < (uint32_t)0x10000) {   bytes_to_write = 3;
             } else if (ch <= max_legal_utf32) {  bytes_to_write = 4;
@@ -1050,6 +1234,7 @@ namespace jsoncons { namespace unicode_traits {
             Container& target, 
             conv_flags flags = conv_flags::strict) 
     {
+        reserve_hint(target, length);
         conv_errc  result = conv_errc();
 
         const CharT* last = data + length;
@@ -1095,6 +1280,7 @@ namespace jsoncons { namespace unicode_traits {
             Container& target, 
             conv_flags flags = conv_flags::strict) 
     {
+        reserve_hint(target, length);
         conv_errc  result = conv_errc();
 
         const CharT* last = data + length;
@@ -1126,16 +1312,162 @@ namespace jsoncons { namespace unicode_traits {
 
     // validate
 
+#if defined(JSONCONS_HAS_SSSE3)
+
+    // Tables for the range-based UTF-8 block validator below. The range index
+    // computed per byte selects the interval of values that byte may take
+    // given its position in a sequence; indices 9-15 are deliberately empty
+    // intervals so that malformed sequences always fail the range check.
+
+    // Leading nibble to character length minus one
+    const int8_t utf8_first_len_tbl[16] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 3
+    };
+    // Leading nibble to range index of a non-ASCII first byte
+    const int8_t utf8_first_range_tbl[16] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8
+    };
+    // Range index to smallest legal byte value
+    const int8_t utf8_range_min_tbl[16] = {
+        0x00, -128, -128, -128, -96, -128, -112, -128,
+        -62, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F
+    };
+    // Range index to largest legal byte value
+    const int8_t utf8_range_max_tbl[16] = {
+        0x7F, -65, -65, -65, -65, -97, -65, -113,
+        -12, -128, -128, -128, -128, -128, -128, -128
+    };
+    // Range adjustments for the second byte after E0 (-> A0..BF) and ED (-> 80..9F)
+    const int8_t utf8_ee_adjust_tbl[16] = {
+        0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0
+    };
+    // Range adjustments for the second byte after F0 (-> 90..BF) and F4 (-> 80..8F)
+    const int8_t utf8_fe_adjust_tbl[16] = {
+        0, 3, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    };
+
+    // Validates whole 16-byte blocks of [data,last) with the range-based
+    // algorithm of Keiser-Lemire (as in cyb70289's range-sse kernel),
+    // accumulating errors over the run. On success, returns the position from
+    // which the scalar loop should resume, backed up over any trailing bytes
+    // whose sequence may continue past the processed blocks; everything
+    // before it is well-formed. If any block failed, returns data unchanged
+    // so the scalar loop can pinpoint the error.
+    template <typename CharT>
+    inline
+    typename std::enable_if<extension_traits::is_char8<CharT>::value, const CharT*>::type
+    validate_utf8_blocks(const CharT* data, const CharT* last) noexcept
+    {
+        if (last - data < 16)
+        {
+            return data;
+        }
+        const __m128i first_len_tbl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_first_len_tbl));
+        const __m128i first_range_tbl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_first_range_tbl));
+        const __m128i range_min_tbl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_range_min_tbl));
+        const __m128i range_max_tbl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_range_max_tbl));
+        const __m128i ee_adjust_tbl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_ee_adjust_tbl));
+        const __m128i fe_adjust_tbl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8_fe_adjust_tbl));
+
+        __m128i prev_input = _mm_setzero_si128();
+        __m128i prev_first_len = _mm_setzero_si128();
+        __m128i error = _mm_setzero_si128();
+
+        const CharT* first = data;
+        const CharT* ptr = data;
+        while (last - ptr >= 16)
+        {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+
+            const __m128i high_nibbles =
+                _mm_and_si128(_mm_srli_epi16(input, 4), _mm_set1_epi8(0x0F));
+
+            // Character length minus one per first byte; zero elsewhere
+            __m128i first_len = _mm_shuffle_epi8(first_len_tbl, high_nibbles);
+
+            // First byte: range index 8 for C0..FF, 0 for ASCII
+            __m128i range = _mm_shuffle_epi8(first_range_tbl, high_nibbles);
+
+            // Second byte: range index is the first byte's length minus one
+            range = _mm_or_si128(range, _mm_alignr_epi8(first_len, prev_first_len, 15));
+
+            // Third and fourth bytes: length minus two and minus three,
+            // saturating at zero
+            __m128i tmp1 = _mm_subs_epu8(first_len, _mm_set1_epi8(1));
+            __m128i tmp2 = _mm_subs_epu8(prev_first_len, _mm_set1_epi8(1));
+            range = _mm_or_si128(range, _mm_alignr_epi8(tmp1, tmp2, 14));
+
+            tmp1 = _mm_subs_epu8(first_len, _mm_set1_epi8(2));
+            tmp2 = _mm_subs_epu8(prev_first_len, _mm_set1_epi8(2));
+            range = _mm_or_si128(range, _mm_alignr_epi8(tmp1, tmp2, 13));
+
+            // Adjust the second-byte range after the special first bytes
+            // E0, ED, F0 and F4, whose continuations are narrower than 80..BF.
+            // Overlapping sequences push the index into the illegal 9..15 band.
+            const __m128i shift1 = _mm_alignr_epi8(input, prev_input, 15);
+            const __m128i pos = _mm_sub_epi8(shift1, _mm_set1_epi8((char)0xEF));
+            tmp1 = _mm_subs_epu8(pos, _mm_set1_epi8((char)0xF0));
+            __m128i range2 = _mm_shuffle_epi8(ee_adjust_tbl, tmp1);
+            tmp2 = _mm_adds_epu8(pos, _mm_set1_epi8(0x70));
+            range2 = _mm_add_epi8(range2, _mm_shuffle_epi8(fe_adjust_tbl, tmp2));
+
+            range = _mm_add_epi8(range, range2);
+
+            const __m128i minv = _mm_shuffle_epi8(range_min_tbl, range);
+            const __m128i maxv = _mm_shuffle_epi8(range_max_tbl, range);
+
+            error = _mm_or_si128(error, _mm_cmplt_epi8(input, minv));
+            error = _mm_or_si128(error, _mm_cmpgt_epi8(input, maxv));
+
+            prev_input = input;
+            prev_first_len = first_len;
+            ptr += 16;
+        }
+
+        if (_mm_movemask_epi8(error) != 0)
+        {
+            return first;
+        }
+
+        // Back up over a trailing sequence that may continue past the last
+        // block so the scalar loop can check it in full.
+        if (!is_continuation_byte(static_cast<uint8_t>(ptr[-1])))
+        {
+            ptr -= 1;
+        }
+        else if (!is_continuation_byte(static_cast<uint8_t>(ptr[-2])))
+        {
+            ptr -= 2;
+        }
+        else if (!is_continuation_byte(static_cast<uint8_t>(ptr[-3])))
+        {
+            ptr -= 3;
+        }
+        return ptr;
+    }
+
+#endif // JSONCONS_HAS_SSSE3
+
     template <typename CharT>
     typename std::enable_if<extension_traits::is_char8<CharT>::value,
-                            convert_result<CharT>>::type 
+                            convert_result<CharT>>::type
     validate(const CharT* data, std::size_t length) noexcept
     {
         conv_errc  result = conv_errc();
         const CharT* last = data + length;
-        while (data != last) 
+#if defined(JSONCONS_HAS_SSSE3)
+        // Whole blocks are range-checked a register at a time; the scalar
+        // loop handles the remainder, or locates the error when a block fails.
+        data = validate_utf8_blocks(data, last);
+#endif
+        while (data != last)
         {
-            std::size_t len = static_cast<std::size_t>(trailing_bytes_for_utf8[static_cast<uint8_t>(*data)]) + 1;
+            skip_ascii(data, last);
+            if (data == last)
+            {
+                break;
+            }
+            std::size_t len = static_cast<std::size_t>(trailing_bytes_for_lead(static_cast<uint8_t>(*data))) + 1;
             if (len > (std::size_t)(last - data))
             {
                 return convert_result<CharT>{data, conv_errc::source_exhausted};
@@ -1302,7 +1634,83 @@ namespace jsoncons { namespace unicode_traits {
     // count_codepoints
 
     template <typename CharT>
-    typename std::enable_if<extension_traits::is_char8<CharT>::value || extension_traits::is_char16<CharT>::value || extension_traits::is_char32<CharT>::value, std::size_t>::type 
+    typename std::enable_if<extension_traits::is_char8<CharT>::value, std::size_t>::type
+    count_codepoints(const CharT* data, std::size_t length,
+                     conv_flags flags = conv_flags::strict) noexcept
+    {
+        // is_legal_utf8 screens surrogates and out-of-range sequences in both
+        // modes, so the count does not depend on the flags.
+        (void)flags;
+
+        if (validate(data, length).ec != conv_errc())
+        {
+            return 0;
+        }
+
+        // In well-formed UTF-8 every codepoint has exactly one
+        // non-continuation byte, so the count is the length minus the
+        // continuation bytes, tallied a word at a time.
+        std::size_t count = length;
+        const CharT* ptr = data;
+        const CharT* last = data + length;
+        while (last - ptr >= 8)
+        {
+            uint64_t chunk;
+            std::memcpy(&chunk, ptr, sizeof(chunk));
+            // High bit set and next bit clear marks a continuation byte;
+            // sum the per-byte flags with a multiply.
+            uint64_t mask = chunk & ~(chunk << 1) & UINT64_C(0x8080808080808080);
+            count -= static_cast<std::size_t>(((mask >> 7) * UINT64_C(0x0101010101010101)) >> 56);
+            ptr += 8;
+        }
+        for (; ptr < last; ++ptr)
+        {
+            if (is_continuation_byte(static_cast<uint8_t>(*ptr)))
+            {
+                --count;
+            }
+        }
+        return count;
+    }
+
+    // Like count_codepoints, but stops counting as soon as the count exceeds
+    // max_count and returns max_count + 1. Input beyond that point is not
+    // validated.
+
+    template <typename CharT>
+    typename std::enable_if<extension_traits::is_char8<CharT>::value, std::size_t>::type 
+    count_codepoints_up_to(const CharT* data, std::size_t length, std::size_t max_count,
+                           conv_flags flags = conv_flags::strict) noexcept
+    {
+        std::size_t count = 0;
+        const CharT* ptr = data;
+        const CharT* last = data + length;
+
+        while (ptr < last) 
+        {
+            count += skip_ascii(ptr, last);
+            if (count > max_count)
+            {
+                return max_count + 1;
+            }
+            if (ptr == last)
+            {
+                break;
+            }
+            uint32_t cp = 0;
+            auto r = to_codepoint(ptr, last, cp, flags);
+            if (r.ec != conv_errc())
+            {
+                return 0;
+            }
+            ptr = r.ptr;
+            ++count;
+        }
+        return count;
+    }
+
+    template <typename CharT>
+    typename std::enable_if<extension_traits::is_char16<CharT>::value || extension_traits::is_char32<CharT>::value, std::size_t>::type 
     count_codepoints(const CharT* data, std::size_t length, 
                      conv_flags flags = conv_flags::strict) noexcept
     {
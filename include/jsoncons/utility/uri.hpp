@@ -649,7 +649,7 @@ namespace jsoncons {
             return uri(uri_encoded_part, std::string(scheme()), userinfo, host, port, path, query, fragment);
         }
 
-        int compare(const uri& other) const
+        int compare(const uri& other) const noexcept
         {
             int result = scheme().compare(other.scheme());
             if (result != 0) return result;
@@ -700,19 +700,35 @@ namespace jsoncons {
 
         static std::string decode_part(const jsoncons::string_view& encoded)
         {
+            // Most parts contain no escapes; copy those in one step.
+            std::size_t first = encoded.find('%');
+            if (first == jsoncons::string_view::npos)
+            {
+                return std::string(encoded.data(), encoded.size());
+            }
+
             std::string decoded;
+            decoded.reserve(encoded.size());
+            decoded.append(encoded.data(), first);
 
             std::size_t length = encoded.size();
-            for (std::size_t i = 0; i < length;)
+            for (std::size_t i = first; i < length;)
             {
                 if (encoded[i] == '%' && (length - i) >= 3)
                 {
-                    auto hex = encoded.substr(i + 1, 2);
-
-                    uint8_t n;
-                    jsoncons::detail::hex_to_integer(hex.data(), hex.size(), n);
-                    decoded.push_back((char)n);
-                    i += 3;
+                    const int h = hex_nibble(encoded[i + 1]);
+                    const int l = hex_nibble(encoded[i + 2]);
+                    if ((h | l) >= 0)
+                    {
+                        decoded.push_back((char)((h << 4) | l));
+                        i += 3;
+                    }
+                    else
+                    {
+                        // Not a valid escape; keep the '%' as-is.
+                        decoded.push_back(encoded[i]);
+                        ++i;
+                    }
                 }
                 else
                 {
@@ -1105,6 +1121,15 @@ namespace jsoncons {
         }
 
     private:
+        // Value of a single hex digit, or -1 if the character is not one.
+        static int hex_nibble(char c)
+        {
+            if (c >= '0' && c <= '9') {return c - '0';}
+            if (c >= 'a' && c <= 'f') {return c - 'a' + 10;}
+            if (c >= 'A' && c <= 'F') {return c - 'A' + 10;}
+            return -1;
+        }
+
         enum class parse_state {
             start,
             expect_scheme,
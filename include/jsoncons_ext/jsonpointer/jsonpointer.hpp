@@ -278,6 +278,14 @@ namespace jsoncons { namespace jsonpointer {
             return *this;
         }
 
+        // Removes the last token. Requires !empty(). Lets callers reuse one
+        // pointer as a push/pop path stack instead of copying all leading
+        // tokens for every child location.
+        void pop_back()
+        {
+            tokens_.pop_back();
+        }
+
         // Accessors
         bool empty() const
         {
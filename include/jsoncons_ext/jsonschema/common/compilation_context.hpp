@@ -66,14 +66,15 @@ namespace jsonschema {
             base_uri_ = uris_.back();
         }
         
-        std::string get_custom_message(const std::string& message_key) const
+        const std::string& get_custom_message(const std::string& message_key) const
         {
+            static const std::string no_message;
             if (!custom_message_.empty())
             {
                 return custom_message_;
             }
             auto it = custom_messages_.find(message_key);
-            return it == custom_messages_.end() ? std::string{} : it->second;
+            return it == custom_messages_.end() ? no_message : it->second;
         }
         
         const std::unordered_map<std::string,std::string>& custom_messages() const
@@ -88,7 +89,7 @@ namespace jsonschema {
             return id_;
         }
 
-        uri get_base_uri() const
+        const uri& get_base_uri() const
         {
             return base_uri_.uri();
         }
@@ -956,11 +956,13 @@ namespace jsonschema {
     }
 
     // format checkers
-    using validate_format = std::function<walk_result(const validation_message_factory& message_factory,
+    // A plain function pointer: all checkers are stateless free functions,
+    // so type erasure through std::function only adds an indirection.
+    using validate_format = walk_result (*)(const validation_message_factory& message_factory,
         const jsonpointer::json_pointer& eval_path, 
         const jsonpointer::json_pointer& instance_location, 
         const std::string&, 
-        error_reporter& reporter)>;
+        error_reporter& reporter);
 
     inline
     walk_result uri_check(const validation_message_factory& message_factory, 
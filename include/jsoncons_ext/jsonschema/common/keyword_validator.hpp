@@ -8,6 +8,7 @@
 #ifndef JSONCONS_EXT_JSONSCHEMA_COMMON_KEYWORD_VALIDATOR_HPP
 #define JSONCONS_EXT_JSONSCHEMA_COMMON_KEYWORD_VALIDATOR_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <iostream>
@@ -15,11 +16,13 @@
 #include <set>
 #include <string>
 #include <system_error>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/write_number.hpp>
 #include <jsoncons/utility/byte_string.hpp>
 #include <jsoncons/conv_error.hpp>
 #include <jsoncons/json_reader.hpp>
@@ -149,7 +152,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class ref_validator : public keyword_validator<Json>, public virtual ref<Json>
+    class ref_validator final : public keyword_validator<Json>, public virtual ref<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using schema_validator_ptr_type = std::unique_ptr<schema_validator<Json>>;
@@ -221,7 +224,7 @@ namespace jsonschema {
     };
     
     template <typename Json>
-    class recursive_ref_validator : public keyword_validator<Json>, public virtual ref<Json>
+    class recursive_ref_validator final : public keyword_validator<Json>, public virtual ref<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using schema_validator_ptr_type = std::unique_ptr<schema_validator<Json>>;
@@ -317,7 +320,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class dynamic_ref_validator : public keyword_validator<Json>, public virtual ref<Json>
+    class dynamic_ref_validator final : public keyword_validator<Json>, public virtual ref<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using schema_validator_ptr_type = std::unique_ptr<schema_validator<Json>>;
@@ -424,7 +427,7 @@ namespace jsonschema {
     // contentEncoding
 
     template <typename Json>
-    class content_encoding_validator : public keyword_validator<Json>
+    class content_encoding_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
@@ -494,20 +497,26 @@ namespace jsonschema {
     // contentMediaType
 
     template <typename Json>
-    class content_media_type_validator : public keyword_validator<Json>
+    class content_media_type_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::string content_media_type_;
         std::string content_encoding_;
+        // Resolved once at schema-build time so do_validate compares flags,
+        // not strings
+        bool is_application_json_;
+        bool is_base64_;
 
     public:
         content_media_type_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, 
             const std::string& content_media_type,
             const std::string& content_encoding)
             : keyword_validator<Json>("contentMediaType", schema, schema_location, custom_message), 
-              content_media_type_(content_media_type), content_encoding_(content_encoding)
+              content_media_type_(content_media_type), content_encoding_(content_encoding),
+              is_application_json_(content_media_type == "application/json"),
+              is_base64_(content_encoding == "base64")
         {
         }
 
@@ -523,9 +532,16 @@ namespace jsonschema {
             {
                 return walk_result::advance;
             }
+            if (!is_application_json_)
+            {
+                // Only application/json content is inspected; for other media
+                // types neither the string copy nor the base64 decode would
+                // ever be looked at, and a decode failure is not an error.
+                return walk_result::advance;
+            }
             
             std::string str = instance.as_string();
-            if (content_encoding_ == "base64")
+            if (is_base64_)
             {
                 std::string content;
                 auto retval = jsoncons::decode_base64(str.begin(), str.end(), content);
@@ -538,7 +554,7 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            if (content_media_type_ == "application/json")
+            if (is_application_json_)
             {
                 json_string_reader reader(str);
                 std::error_code ec;
@@ -569,7 +585,7 @@ namespace jsonschema {
     // format 
 
     template <typename Json>
-    class format_validator : public keyword_validator<Json>
+    class format_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
@@ -616,23 +632,149 @@ namespace jsonschema {
         }
     };
 
+#if defined(JSONCONS_HAS_STD_REGEX)
+    // A compiled "pattern" / "patternProperties" pattern, classified at
+    // schema-build time. A pattern that is a literal apart from optional
+    // ^ and $ anchors is matched with plain string comparisons and never
+    // touches the regex engine; everything else compiles to std::regex.
+    class string_pattern
+    {
+        enum class match_kind : uint8_t {regex, substring, exact, prefix, suffix};
+
+        std::string pattern_string_;
+        std::regex regex_;
+        match_kind kind_;
+        std::string literal_;
+        std::string required_prefix_;
+
+    public:
+        explicit string_pattern(const std::string& pattern_string)
+            : pattern_string_(pattern_string)
+        {
+            kind_ = analyze(pattern_string_, literal_);
+            if (kind_ == match_kind::regex)
+            {
+                required_prefix_ = literal_prefix(pattern_string_);
+                // Compiled once at schema build and searched many times, so
+                // the slower optimizing construction pays for itself.
+                regex_ = std::regex(pattern_string_, std::regex::ECMAScript | std::regex::optimize);
+            }
+        }
+
+        const std::string& pattern_string() const
+        {
+            return pattern_string_;
+        }
+
+        bool search(const std::string& s) const
+        {
+            switch (kind_)
+            {
+                case match_kind::exact:
+                    return s == literal_;
+                case match_kind::prefix:
+                    return s.size() >= literal_.size() && s.compare(0, literal_.size(), literal_) == 0;
+                case match_kind::suffix:
+                    return s.size() >= literal_.size() && s.compare(s.size() - literal_.size(), literal_.size(), literal_) == 0;
+                case match_kind::substring:
+                    return s.find(literal_) != std::string::npos;
+                default:
+                    if (!required_prefix_.empty() &&
+                        (s.size() < required_prefix_.size() ||
+                         s.compare(0, required_prefix_.size(), required_prefix_) != 0))
+                    {
+                        return false;
+                    }
+                    return std::regex_search(s, regex_);
+            }
+        }
+
+    private:
+        static match_kind analyze(const std::string& pattern, std::string& literal)
+        {
+            std::size_t first = 0;
+            std::size_t last = pattern.size();
+            const bool anchored_front = first < last && pattern.front() == '^';
+            if (anchored_front)
+            {
+                ++first;
+            }
+            const bool anchored_back = first < last && pattern.back() == '$';
+            if (anchored_back)
+            {
+                --last;
+            }
+            static const char metacharacters[] = "^$.|?*+()[]{}\\";
+            std::size_t pos = pattern.find_first_of(metacharacters, first);
+            if (pos < last)
+            {
+                return match_kind::regex;
+            }
+            literal = pattern.substr(first, last - first);
+            if (anchored_front && anchored_back)
+            {
+                return match_kind::exact;
+            }
+            if (anchored_front)
+            {
+                return match_kind::prefix;
+            }
+            if (anchored_back)
+            {
+                return match_kind::suffix;
+            }
+            return match_kind::substring;
+        }
+
+        // A pattern anchored with '^' has to match its literal lead-in, up
+        // to the first metacharacter, so strings without that prefix can
+        // skip the regex engine. A top-level alternation would limit the
+        // anchor to the first branch; any '|' disables the screen rather
+        // than parsing grouping to rule that out.
+        static std::string literal_prefix(const std::string& pattern)
+        {
+            if (pattern.empty() || pattern.front() != '^' || pattern.find('|') != std::string::npos)
+            {
+                return std::string();
+            }
+            static const char metacharacters[] = "^$.|?*+()[]{}\\";
+            std::size_t pos = pattern.find_first_of(metacharacters, 1);
+            if (pos == std::string::npos)
+            {
+                pos = pattern.size();
+            }
+            std::size_t length = pos - 1;
+            // A trailing quantifier can make the last literal character
+            // optional ('?', '*') or bounded from zero ('{'); drop it.
+            if (pos < pattern.size() && (pattern[pos] == '?' || pattern[pos] == '*' || pattern[pos] == '{'))
+            {
+                if (length == 0)
+                {
+                    return std::string();
+                }
+                --length;
+            }
+            return pattern.substr(1, length);
+        }
+    };
+#endif
+
     // pattern 
 
 #if defined(JSONCONS_HAS_STD_REGEX)
     template <typename Json>
-    class pattern_validator : public keyword_validator<Json>
+    class pattern_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
-        std::string pattern_string_;
-        std::regex regex_;
+        string_pattern pattern_;
 
     public:
         pattern_validator(const Json& schema, const uri& schema_location, const std::string& custom_message,
-            const std::string& pattern_string, const std::regex& regex)
+            const std::string& pattern_string)
             : keyword_validator<Json>("pattern", schema, schema_location, custom_message), 
-              pattern_string_(pattern_string), regex_(regex)
+              pattern_(pattern_string)
         {
         }
 
@@ -652,12 +794,12 @@ namespace jsonschema {
             eval_context<Json> this_context(context, this->keyword_name());
 
             auto s = instance.template as<std::string>();
-            if (!std::regex_search(s, regex_))
+            if (!pattern_.search(s))
             {
                 std::string message("String '");
                 message.append(s);
                 message.append("' does not match pattern '");
-                message.append(pattern_string_);
+                message.append(pattern_.pattern_string());
                 message.append("'.");
                 walk_result result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
@@ -679,7 +821,7 @@ namespace jsonschema {
     };
 #else
     template <typename Json>
-    class pattern_validator : public keyword_validator<Json>
+    class pattern_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
@@ -712,15 +854,17 @@ namespace jsonschema {
     // maxLength
 
     template <typename Json>
-    class max_length_validator : public keyword_validator<Json>
+    class max_length_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::size_t max_length_{0};
+        std::string message_;
     public:
         max_length_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, std::size_t max_length)
-            : keyword_validator<Json>("maxLength", schema, schema_location, custom_message), max_length_(max_length)
+            : keyword_validator<Json>("maxLength", schema, schema_location, custom_message), max_length_(max_length),
+              message_("Number of characters must be at most " + std::to_string(max_length))
         {
         }
         
@@ -739,16 +883,22 @@ namespace jsonschema {
                 return walk_result::advance;
             }
 
+            auto sv = instance.as_string_view();
+            if (sv.size() <= max_length_)
+            {
+                // Codepoints can never outnumber code units
+                return walk_result::advance;
+            }
+
             eval_context<Json> this_context(context, this->keyword_name());
 
-            auto sv = instance.as_string_view();
-            std::size_t length = unicode_traits::count_codepoints(sv.data(), sv.size());
+            std::size_t length = unicode_traits::count_codepoints_up_to(sv.data(), sv.size(), max_length_);
             if (length > max_length_)
             {
                 walk_result result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
                     instance_location, 
-                    std::string("Number of characters must be at most ") + std::to_string(max_length_)));
+                    message_));
                 if (result == walk_result::abort)
                 {
                     return result;
@@ -767,16 +917,18 @@ namespace jsonschema {
     // minLength
 
     template <typename Json>
-    class min_length_validator : public keyword_validator<Json>
+    class min_length_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::size_t min_length_;
+        std::string message_;
 
     public:
         min_length_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, std::size_t min_length)
-            : keyword_validator<Json>("minLength", schema, schema_location, custom_message), min_length_(min_length)
+            : keyword_validator<Json>("minLength", schema, schema_location, custom_message), min_length_(min_length),
+              message_("Number of characters must be at least " + std::to_string(min_length))
         {
         }
 
@@ -793,22 +945,24 @@ namespace jsonschema {
                 return walk_result::advance;
             }
 
-            eval_context<Json> this_context(context, this->keyword_name());
-
             auto sv = instance.as_string_view();
-            std::size_t length = unicode_traits::count_codepoints(sv.data(), sv.size());
-            if (length < min_length_) 
+            // A UTF-8 string has at least as many bytes as codepoints, so a
+            // string that is too short in bytes is too short in codepoints
+            // without decoding anything.
+            if (sv.size() >= min_length_)
             {
-                walk_result result = reporter.error(this->make_validation_message(
-                    this_context.eval_path(),
-                    instance_location, 
-                    std::string("Number of characters must be at least ") + std::to_string(min_length_)));
-                if (result == walk_result::abort)
+                if (min_length_ == 0 ||
+                    unicode_traits::count_codepoints_up_to(sv.data(), sv.size(), min_length_ - 1) >= min_length_)
                 {
-                    return result;
+                    return walk_result::advance;
                 }
             }
-            return walk_result::advance;
+
+            eval_context<Json> this_context(context, this->keyword_name());
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location,
+                message_));
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -821,15 +975,17 @@ namespace jsonschema {
     // maxItems
 
     template <typename Json>
-    class max_items_validator : public keyword_validator<Json>
+    class max_items_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::size_t max_items_;
+        std::string message_;
     public:
         max_items_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, std::size_t max_items)
-            : keyword_validator<Json>("maxItems", schema, schema_location, custom_message), max_items_(max_items)
+            : keyword_validator<Json>("maxItems", schema, schema_location, custom_message), max_items_(max_items),
+              message_("Maximum number of items is " + std::to_string(max_items) + " but found ")
         {
         }
 
@@ -846,22 +1002,19 @@ namespace jsonschema {
                 return walk_result::advance;
             }
 
-            eval_context<Json> this_context(context, this->keyword_name());
-
-            if (instance.size() > max_items_)
+            const std::size_t size = instance.size();
+            if (JSONCONS_LIKELY(size <= max_items_))
             {
-                std::string message("Maximum number of items is " + std::to_string(max_items_));
-                message.append(" but found " + std::to_string(instance.size()));
-                walk_result result = reporter.error(this->make_validation_message(
-                    this_context.eval_path(),
-                    instance_location, 
-                    std::move(message)));
-                if (result == walk_result::abort)
-                {
-                    return result;
-                }
-            }          
-            return walk_result::advance;
+                return walk_result::advance;
+            }
+
+            eval_context<Json> this_context(context, this->keyword_name());
+            std::string message(message_);
+            jsoncons::detail::from_integer(size, message);
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                std::move(message)));
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -874,16 +1027,18 @@ namespace jsonschema {
     // minItems
 
     template <typename Json>
-    class min_items_validator : public keyword_validator<Json>
+    class min_items_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::size_t min_items_;
+        std::string message_;
     public:
         min_items_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, 
             std::size_t min_items)
-            : keyword_validator<Json>("minItems", schema, schema_location, custom_message), min_items_(min_items)
+            : keyword_validator<Json>("minItems", schema, schema_location, custom_message), min_items_(min_items),
+              message_("Minimum number of items is " + std::to_string(min_items) + " but found ")
         {
         }
 
@@ -900,22 +1055,19 @@ namespace jsonschema {
                 return walk_result::advance;
             }
 
-            eval_context<Json> this_context(context, this->keyword_name());
-
-            if (instance.size() < min_items_)
+            const std::size_t size = instance.size();
+            if (JSONCONS_LIKELY(size >= min_items_))
             {
-                std::string message("Minimum number of items is " + std::to_string(min_items_));
-                message.append(" but found " + std::to_string(instance.size()));
-                walk_result result = reporter.error(this->make_validation_message(
-                    this_context.eval_path(),
-                    instance_location, 
-                    std::move(message)));
-                if (result == walk_result::abort)
-                {
-                    return result;
-                }
-            }          
-            return walk_result::advance;
+                return walk_result::advance;
+            }
+
+            eval_context<Json> this_context(context, this->keyword_name());
+            std::string message(message_);
+            jsoncons::detail::from_integer(size, message);
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                std::move(message)));
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -928,7 +1080,7 @@ namespace jsonschema {
     // items
 
     template <typename Json>
-    class items_validator : public keyword_validator<Json>
+    class items_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -982,15 +1134,19 @@ namespace jsonschema {
                     std::size_t index = 0;
                     std::size_t start = 0;
                     std::size_t end = 0;
+                    // Reused as a push/pop path stack to avoid copying the
+                    // leading tokens for every item.
+                    jsonpointer::json_pointer item_location = instance_location;
                     for (const auto& item : instance.array_range()) 
                     {
-                        jsonpointer::json_pointer item_location = instance_location / index;
+                        item_location /= index;
                         std::size_t errors = reporter.error_count();
                         walk_result result = schema_val_->validate(this_context, item, item_location, results, reporter, patch);
                         if (result == walk_result::abort)
                         {
                             return result;
                         }
+                        item_location.pop_back();
                         if (errors == reporter.error_count())
                         {
                             if (context.require_evaluated_items())
@@ -1039,14 +1195,16 @@ namespace jsonschema {
             if (schema_val_) 
             {
                 std::size_t index = 0;
+                jsonpointer::json_pointer item_location = instance_location;
                 for (const auto& item : instance.array_range()) 
                 {
-                    jsonpointer::json_pointer item_location = instance_location / index;
+                    item_location /= index;
                     result = schema_val_->walk(context, item, item_location, reporter);
                     if (result == walk_result::abort)
                     {
                         return result;
                     }
+                    item_location.pop_back();
                     ++index;
                 }
             }
@@ -1056,10 +1214,112 @@ namespace jsonschema {
 
     // items
 
+    inline std::size_t combine_hash(std::size_t seed, std::size_t h)
+    {
+        return seed ^ (h + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    }
+
+    // A hash consistent with operator== - equal values hash equal, so
+    // distinct hashes prove distinct values; equal hashes are re-checked
+    // with a full comparison.
+    template <typename Json>
+    std::size_t json_hash(const Json& value)
+    {
+        switch (value.type())
+        {
+            case json_type::null_value:
+                return 0x610e9565;
+            case json_type::bool_value:
+                return value.template as<bool>() ? 0x9bd1e995 : 0x735a2d97;
+            case json_type::int64_value:
+            case json_type::uint64_value:
+            case json_type::half_value:
+            case json_type::double_value:
+            {
+                // Mixed-type numeric comparisons are defined through double,
+                // so equal numbers must hash through the same double as well.
+                double x = value.template as<double>();
+                if (x == 0)
+                {
+                    x = 0; // fold -0.0 onto 0.0
+                }
+                return std::hash<double>()(x);
+            }
+            case json_type::string_value:
+            {
+                // Number-tagged strings (e.g. bigint) compare numerically
+                // through double, so they must hash that way as well.
+                if (is_number_tag(value.tag()))
+                {
+                    double x = value.template as<double>();
+                    if (x == 0)
+                    {
+                        x = 0; // fold -0.0 onto 0.0
+                    }
+                    return std::hash<double>()(x);
+                }
+                return std::hash<typename Json::string_view_type>()(value.as_string_view());
+            }
+            case json_type::byte_string_value:
+            {
+                auto bsv = value.as_byte_string_view();
+                std::size_t h = static_cast<std::size_t>(0xcbf29ce484222325ULL);
+                for (auto b : bsv)
+                {
+                    h = (h ^ static_cast<std::size_t>(b)) * static_cast<std::size_t>(0x100000001b3ULL);
+                }
+                return h;
+            }
+            case json_type::array_value:
+            {
+                std::size_t h = 0x23fb7532;
+                for (const auto& item : value.array_range())
+                {
+                    h = combine_hash(h, json_hash(item));
+                }
+                return h;
+            }
+            case json_type::object_value:
+            {
+                // Object comparison ignores member order, so member hashes
+                // are combined with a commutative operation.
+                std::size_t h = 0x85ebca6b;
+                for (const auto& member : value.object_range())
+                {
+                    typename Json::string_view_type key(member.key().data(), member.key().size());
+                    h += combine_hash(std::hash<typename Json::string_view_type>()(key), json_hash(member.value()));
+                }
+                return h;
+            }
+            default:
+                return 0;
+        }
+    }
+
+    // Looks up a key in a vector of (name, value) pairs sorted by name.
+    // Keyword tables are usually small, where a linear scan beats binary
+    // search.
+    template <typename Pair>
+    typename std::vector<Pair>::const_iterator find_member(const std::vector<Pair>& items, const std::string& key)
+    {
+        if (items.size() <= 8)
+        {
+            auto it = items.begin();
+            while (it != items.end() && (*it).first != key)
+            {
+                ++it;
+            }
+            return it;
+        }
+        auto it = std::lower_bound(items.begin(), items.end(), key,
+            [](const Pair& item, const std::string& k) {return item.first < k;});
+        return (it != items.end() && (*it).first == key) ? it : items.end();
+    }
+
     // uniqueItems
 
     template <typename Json>
-    class unique_items_validator : public keyword_validator<Json>
+    class unique_items_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
@@ -1100,17 +1360,38 @@ namespace jsonschema {
             return walk_result::advance;
         }
 
-        static bool array_has_unique_items(const Json& a) 
+        static bool array_has_unique_items(const Json& a)
         {
-            for (auto it = a.array_range().begin(); it != a.array_range().end(); ++it) 
+            // Pairwise comparison is cheaper for short arrays.
+            if (a.size() <= 8)
+            {
+                for (auto it = a.array_range().begin(); it != a.array_range().end(); ++it)
+                {
+                    for (auto jt = it+1; jt != a.array_range().end(); ++jt)
+                    {
+                        if (*it == *jt)
+                        {
+                            return false; // contains duplicates
+                        }
+                    }
+                }
+                return true; // elements are unique
+            }
+
+            std::unordered_multimap<std::size_t, const Json*> seen;
+            seen.reserve(a.size());
+            for (const auto& item : a.array_range())
             {
-                for (auto jt = it+1; jt != a.array_range().end(); ++jt) 
+                std::size_t h = json_hash(item);
+                auto range = seen.equal_range(h);
+                for (auto it = range.first; it != range.second; ++it)
                 {
-                    if (*it == *jt) 
+                    if (*(*it).second == item)
                     {
-                        return false; // contains duplicates 
+                        return false; // contains duplicates
                     }
                 }
+                seen.emplace(h, std::addressof(item));
             }
             return true; // elements are unique
         }
@@ -1125,7 +1406,7 @@ namespace jsonschema {
     // not
 
     template <typename Json>
-    class not_validator : public keyword_validator<Json>
+    class not_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -1162,14 +1443,13 @@ namespace jsonschema {
             eval_context<Json> this_context(context, this->keyword_name());
 
             evaluation_results local_results;
-            collecting_error_listener local_reporter;
+            // Stop evaluating the subschema at its first error; only the
+            // existence of an error matters here. An abort result below is
+            // the listener unwinding, not a caller request to stop.
+            first_error_listener local_reporter;
             walk_result result = schema_val_->validate(this_context, instance, instance_location, local_results, local_reporter, patch);
-            if (result == walk_result::abort)
-            {
-                return result;
-            }
 
-            if (local_reporter.errors.empty())
+            if (local_reporter.error_count() == 0)
             {
                 result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
@@ -1195,7 +1475,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class any_of_validator : public keyword_validator<Json>
+    class any_of_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -1291,7 +1571,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class one_of_validator : public keyword_validator<Json>
+    class one_of_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -1356,14 +1636,16 @@ namespace jsonschema {
                 }
                 else
                 {
-                    message = "Must be valid against exactly one schema, but found " + std::to_string(indices.size()) + " matching schemas at indices ";
+                    message = "Must be valid against exactly one schema, but found ";
+                    jsoncons::detail::from_integer(indices.size(), message);
+                    message.append(" matching schemas at indices ");
                     for (std::size_t i = 0; i < indices.size(); ++i)
                     {
                         if (i > 0)
                         {
                             message.push_back(',');
                         }
-                        message.append(std::to_string(i));
+                        jsoncons::detail::from_integer(i, message);
                     }
                 }
                 walk_result result = reporter.error(this->make_validation_message(
@@ -1406,7 +1688,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class all_of_validator : public keyword_validator<Json>
+    class all_of_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -1430,15 +1712,12 @@ namespace jsonschema {
             error_reporter& reporter, 
             Json& patch) const final
         {
-            //std::cout << this->keyword_name() << " [" << context.eval_path().string() << ", " << this->schema_location().string() << "]\n";
-
             evaluation_results local_results1;
             collecting_error_listener local_reporter;
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            std::size_t count = 0;
-            for (std::size_t i = 0; i < validators_.size(); ++i) 
+            for (std::size_t i = 0; i < validators_.size(); ++i)
             {
                 evaluation_results local_results2;
                 eval_context<Json> item_context(this_context, i);
@@ -1449,26 +1728,14 @@ namespace jsonschema {
                 {
                     return result;
                 }
-                //std::cout << "local_results2:\n";
-                //for (const auto& s : local_results2.evaluated_items)
-                //{
-                //    std::cout << "    " << s << "\n";
-                //}
                 if (errors == local_reporter.errors.size())
                 {
                     local_results1.merge(local_results2);
-                    ++count;
                 }
-                //std::cout << "success: " << i << " " << success << "\n";
             }
 
-            //std::cout << "local_results1:\n";
-            //for (const auto& s : local_results1.evaluated_items)
-            //{
-            //    std::cout << "    " << s << "\n";
-            //}
-
-            if (count == validators_.size())
+            // Every subschema succeeded exactly when no errors were collected.
+            if (local_reporter.errors.empty())
             {
                 results.merge(local_results1);
             }
@@ -1513,18 +1780,28 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class maximum_validator : public keyword_validator<Json>
+    class maximum_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         Json value_;
         std::string message_;
+        // Comparand in native form, converted once at schema-build time. The
+        // factory guarantees value is a number.
+        bool value_is_int64_;
+        int64_t int64_value_;
+        bool value_is_uint64_;
+        uint64_t uint64_value_;
+        double double_value_;
 
     public:
         maximum_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, const Json& value)
             : keyword_validator<Json>("maximum", schema, schema_location, custom_message), value_(value),
-              message_{"Maximum value is " + value.template as<std::string>() + " but found"}
+              message_{"Maximum value is " + value.template as<std::string>() + " but found"},
+              value_is_int64_(value.is_int64()), int64_value_(value_is_int64_ ? value.template as<int64_t>() : 0),
+              value_is_uint64_(value.is_uint64()), uint64_value_(value_is_uint64_ ? value.template as<uint64_t>() : 0),
+              double_value_(value.is_number() ? value.template as<double>() : 0.0)
         {
         }
 
@@ -1536,69 +1813,43 @@ namespace jsonschema {
             error_reporter& reporter, 
             Json& /*patch*/) const final 
         {
+            if (JSONCONS_LIKELY(!violates(instance)))
+            {
+                return walk_result::advance;
+            }
+            // Only failing instances pay for extending the evaluation path.
             eval_context<Json> this_context(context, this->keyword_name());
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                message_ + instance.template as<std::string>()));
+        }
 
-            if (instance.is_int64() && value_.is_int64())
+        // A single comparison against the precomputed comparand on the
+        // common numeric paths.
+        bool violates(const Json& instance) const
+        {
+            if (instance.is_int64() && value_is_int64_)
             {
-                if (instance.template as<int64_t>() > value_.template as<int64_t>())
-                {
-                walk_result result = reporter.error(this->make_validation_message(
-                    this_context.eval_path(),
-                    instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<int64_t>() > int64_value_;
             }
-            else if (instance.is_uint64() && value_.is_uint64())
+            if (instance.is_uint64() && value_is_uint64_)
             {
-                if (instance.template as<uint64_t>() > value_.template as<uint64_t>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<uint64_t>() > uint64_value_;
             }
-            else if (instance.is_string_view() && instance.tag() == semantic_tag::bigint)
+            if (instance.is_string_view() && instance.tag() == semantic_tag::bigint)
             {
                 auto sv1 = instance.as_string_view();
                 bigint n1 = bigint::from_string(sv1.data(), sv1.length());
                 auto s2 = value_.as_string();
                 bigint n2 = bigint::from_string(s2.data(), s2.length());
-                if (n1 > n2)
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return n1 > n2;
             }
-            else if (instance.is_number())
+            if (instance.is_number())
             {
-                if (instance.template as<double>() > value_.template as<double>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<double>() > double_value_;
             }
-            return walk_result::advance;
+            return false;
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -1609,18 +1860,28 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class exclusive_maximum_validator : public keyword_validator<Json>
+    class exclusive_maximum_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         Json value_;
         std::string message_;
+        // Comparand in native form, converted once at schema-build time. The
+        // factory guarantees value is a number.
+        bool value_is_int64_;
+        int64_t int64_value_;
+        bool value_is_uint64_;
+        uint64_t uint64_value_;
+        double double_value_;
 
     public:
         exclusive_maximum_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, const Json& value)
             : keyword_validator<Json>("exclusiveMaximum", schema, schema_location, custom_message), value_(value),
-              message_{"Exclusive maximum value is " + value.template as<std::string>() + " but found "}
+              message_{"Exclusive maximum value is " + value.template as<std::string>() + " but found "},
+              value_is_int64_(value.is_int64()), int64_value_(value_is_int64_ ? value.template as<int64_t>() : 0),
+              value_is_uint64_(value.is_uint64()), uint64_value_(value_is_uint64_ ? value.template as<uint64_t>() : 0),
+              double_value_(value.is_number() ? value.template as<double>() : 0.0)
         {
         }
 
@@ -1632,69 +1893,43 @@ namespace jsonschema {
             error_reporter& reporter, 
             Json& /*patch*/) const final 
         {
+            if (JSONCONS_LIKELY(!violates(instance)))
+            {
+                return walk_result::advance;
+            }
+            // Only failing instances pay for extending the evaluation path.
             eval_context<Json> this_context(context, this->keyword_name());
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                message_ + instance.template as<std::string>()));
+        }
 
-            if (instance.is_int64() && value_.is_int64())
+        // A single comparison against the precomputed comparand on the
+        // common numeric paths.
+        bool violates(const Json& instance) const
+        {
+            if (instance.is_int64() && value_is_int64_)
             {
-                if (instance.template as<int64_t>() >= value_.template as<int64_t>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<int64_t>() >= int64_value_;
             }
-            else if (instance.is_uint64() && value_.is_uint64())
+            if (instance.is_uint64() && value_is_uint64_)
             {
-                if (instance.template as<uint64_t>() >= value_.template as<uint64_t>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<uint64_t>() >= uint64_value_;
             }
-            else if (instance.is_string_view() && instance.tag() == semantic_tag::bigint)
+            if (instance.is_string_view() && instance.tag() == semantic_tag::bigint)
             {
                 auto sv1 = instance.as_string_view();
                 bigint n1 = bigint::from_string(sv1.data(), sv1.length());
                 auto s2 = value_.as_string();
                 bigint n2 = bigint::from_string(s2.data(), s2.length());
-                if (n1 >= n2)
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return n1 >= n2;
             }
-            else if (instance.is_number())
+            if (instance.is_number())
             {
-                if (instance.template as<double>() >= value_.template as<double>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<double>() >= double_value_;
             }
-            return walk_result::advance;
+            return false;
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -1705,18 +1940,28 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class minimum_validator : public keyword_validator<Json>
+    class minimum_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         Json value_;
         std::string message_;
+        // Comparand in native form, converted once at schema-build time. The
+        // factory guarantees value is a number.
+        bool value_is_int64_;
+        int64_t int64_value_;
+        bool value_is_uint64_;
+        uint64_t uint64_value_;
+        double double_value_;
 
     public:
         minimum_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, const Json& value)
             : keyword_validator<Json>("minimum", schema, schema_location, custom_message), value_(value),
-              message_{"Minimum value is " + value.template as<std::string>() + " but found "}
+              message_{"Minimum value is " + value.template as<std::string>() + " but found "},
+              value_is_int64_(value.is_int64()), int64_value_(value_is_int64_ ? value.template as<int64_t>() : 0),
+              value_is_uint64_(value.is_uint64()), uint64_value_(value_is_uint64_ ? value.template as<uint64_t>() : 0),
+              double_value_(value.is_number() ? value.template as<double>() : 0.0)
         {
         }
 
@@ -1726,71 +1971,45 @@ namespace jsonschema {
             const jsonpointer::json_pointer& instance_location,
             evaluation_results& /*results*/, 
             error_reporter& reporter, 
-            Json& /*patch*/) const final
+            Json& /*patch*/) const final 
         {
+            if (JSONCONS_LIKELY(!violates(instance)))
+            {
+                return walk_result::advance;
+            }
+            // Only failing instances pay for extending the evaluation path.
             eval_context<Json> this_context(context, this->keyword_name());
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                message_ + instance.template as<std::string>()));
+        }
 
-            if (instance.is_int64() && value_.is_int64())
+        // A single comparison against the precomputed comparand on the
+        // common numeric paths.
+        bool violates(const Json& instance) const
+        {
+            if (instance.is_int64() && value_is_int64_)
             {
-                if (instance.template as<int64_t>() < value_.template as<int64_t>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<int64_t>() < int64_value_;
             }
-            else if (instance.is_uint64() && value_.is_uint64())
+            if (instance.is_uint64() && value_is_uint64_)
             {
-                if (instance.template as<uint64_t>() < value_.template as<uint64_t>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<uint64_t>() < uint64_value_;
             }
-            else if (instance.is_string_view() && instance.tag() == semantic_tag::bigint)
+            if (instance.is_string_view() && instance.tag() == semantic_tag::bigint)
             {
                 auto sv1 = instance.as_string_view();
                 bigint n1 = bigint::from_string(sv1.data(), sv1.length());
                 auto s2 = value_.as_string();
                 bigint n2 = bigint::from_string(s2.data(), s2.length());
-                if (n1 < n2)
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return n1 < n2;
             }
-            else if (instance.is_number())
+            if (instance.is_number())
             {
-                if (instance.template as<double>() < value_.template as<double>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<double>() < double_value_;
             }
-            return walk_result::advance;
+            return false;
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -1801,18 +2020,28 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class exclusive_minimum_validator : public keyword_validator<Json>
+    class exclusive_minimum_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         Json value_;
         std::string message_;
+        // Comparand in native form, converted once at schema-build time. The
+        // factory guarantees value is a number.
+        bool value_is_int64_;
+        int64_t int64_value_;
+        bool value_is_uint64_;
+        uint64_t uint64_value_;
+        double double_value_;
 
     public:
         exclusive_minimum_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, const Json& value)
             : keyword_validator<Json>("exclusiveMinimum", schema, schema_location, custom_message), value_(value),
-              message_{"Exclusive minimum value is " + value.template as<std::string>() + " but found "}
+              message_{"Exclusive minimum value is " + value.template as<std::string>() + " but found "},
+              value_is_int64_(value.is_int64()), int64_value_(value_is_int64_ ? value.template as<int64_t>() : 0),
+              value_is_uint64_(value.is_uint64()), uint64_value_(value_is_uint64_ ? value.template as<uint64_t>() : 0),
+              double_value_(value.is_number() ? value.template as<double>() : 0.0)
         {
         }
 
@@ -1824,69 +2053,43 @@ namespace jsonschema {
             error_reporter& reporter, 
             Json& /*patch*/) const final 
         {
-            eval_context<Json> this_context(context, this->keyword_name());
-
-            if (instance.is_int64() && value_.is_int64())
+            if (JSONCONS_LIKELY(!violates(instance)))
             {
-                if (instance.template as<int64_t>() <= value_.template as<int64_t>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return walk_result::advance;
             }
-            else if (instance.is_uint64() && value_.is_uint64())
-            {
-                if (instance.template as<uint64_t>() <= value_.template as<uint64_t>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+            // Only failing instances pay for extending the evaluation path.
+            eval_context<Json> this_context(context, this->keyword_name());
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                message_ + instance.template as<std::string>()));
+        }
+
+        // A single comparison against the precomputed comparand on the
+        // common numeric paths.
+        bool violates(const Json& instance) const
+        {
+            if (instance.is_int64() && value_is_int64_)
+            {
+                return instance.template as<int64_t>() <= int64_value_;
+            }
+            if (instance.is_uint64() && value_is_uint64_)
+            {
+                return instance.template as<uint64_t>() <= uint64_value_;
             }
-            else if (instance.is_string_view() && instance.tag() == semantic_tag::bigint)
+            if (instance.is_string_view() && instance.tag() == semantic_tag::bigint)
             {
                 auto sv1 = instance.as_string_view();
                 bigint n1 = bigint::from_string(sv1.data(), sv1.length());
                 auto s2 = value_.as_string();
                 bigint n2 = bigint::from_string(s2.data(), s2.length());
-                if (n1 <= n2)
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return n1 <= n2;
             }
-            else if (instance.is_number())
+            if (instance.is_number())
             {
-                if (instance.template as<double>() <= value_.template as<double>())
-                {
-                    walk_result result = reporter.error(this->make_validation_message(
-                        this_context.eval_path(),
-                        instance_location, 
-                        message_ + instance.template as<std::string>()));
-                    if (result == walk_result::abort)
-                    {
-                        return result;
-                    }
-                }
+                return instance.template as<double>() <= double_value_;
             }
-            return walk_result::advance;
+            return false;
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -1897,16 +2100,18 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class multiple_of_validator : public keyword_validator<Json>
+    class multiple_of_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         double value_;
+        std::string message_;
 
     public:
         multiple_of_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, double value)
-            : keyword_validator<Json>("multipleOf", schema, schema_location, custom_message), value_(value)
+            : keyword_validator<Json>("multipleOf", schema, schema_location, custom_message), value_(value),
+              message_{" is not a multiple of " + std::to_string(value)}
         {
         }
 
@@ -1932,7 +2137,7 @@ namespace jsonschema {
                     walk_result result = reporter.error(this->make_validation_message(
                         this_context.eval_path(),
                         instance_location, 
-                        instance.template as<std::string>() + " is not a multiple of " + std::to_string(value_)));
+                        instance.template as<std::string>() + message_));
                     if (result == walk_result::abort)
                     {
                         return result;
@@ -1957,17 +2162,20 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class required_validator : public keyword_validator<Json>
+    class required_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
+        // Owning copies: with $dynamicRef and remote references the schema
+        // document a validator was compiled from can be a temporary that is
+        // discarded after compilation, so views into it would dangle.
         std::vector<std::string> items_;
 
     public:
         required_validator(const Json& schema, const uri& schema_location, const std::string& custom_message,
-            const std::vector<std::string>& items)
-            : keyword_validator<Json>("required", schema, schema_location, custom_message), items_(items)
+            std::vector<std::string>&& items)
+            : keyword_validator<Json>("required", schema, schema_location, custom_message), items_(std::move(items))
         {
         }
 
@@ -2019,16 +2227,18 @@ namespace jsonschema {
     // maxProperties
 
     template <typename Json>
-    class max_properties_validator : public keyword_validator<Json>
+    class max_properties_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::size_t max_properties_;
+        std::string message_;
     public:
         max_properties_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, 
             std::size_t max_properties)
-            : keyword_validator<Json>("maxProperties", schema, schema_location, custom_message), max_properties_(max_properties)
+            : keyword_validator<Json>("maxProperties", schema, schema_location, custom_message), max_properties_(max_properties),
+              message_("Maximum number of properties is " + std::to_string(max_properties) + " but found ")
         {
         }
 
@@ -2044,23 +2254,20 @@ namespace jsonschema {
             {
                 return walk_result::advance;
             }
-            
-            if (instance.size() > max_properties_)
-            {
-                eval_context<Json> this_context(context, this->keyword_name());
 
-                std::string message("Maximum number of properties is " + std::to_string(max_properties_));
-                message.append(" but found " + std::to_string(instance.size()));
-                walk_result result = reporter.error(this->make_validation_message(
-                    this_context.eval_path(),
-                    instance_location, 
-                    std::move(message)));
-                if (result == walk_result::abort)
-                {
-                    return result;
-                }
+            const std::size_t size = instance.size();
+            if (JSONCONS_LIKELY(size <= max_properties_))
+            {
+                return walk_result::advance;
             }
-            return walk_result::advance;
+
+            eval_context<Json> this_context(context, this->keyword_name());
+            std::string message(message_);
+            jsoncons::detail::from_integer(size, message);
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                std::move(message)));
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -2073,15 +2280,17 @@ namespace jsonschema {
     // minProperties
 
     template <typename Json>
-    class min_properties_validator : public keyword_validator<Json>
+    class min_properties_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::size_t min_properties_;
+        std::string message_;
     public:
         min_properties_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, std::size_t min_properties)
-            : keyword_validator<Json>("minProperties", schema, schema_location, custom_message), min_properties_(min_properties)
+            : keyword_validator<Json>("minProperties", schema, schema_location, custom_message), min_properties_(min_properties),
+              message_("Minimum number of properties is " + std::to_string(min_properties) + " but found ")
         {
         }
 
@@ -2097,23 +2306,20 @@ namespace jsonschema {
             {
                 return walk_result::advance;
             }
-            if (instance.size() < min_properties_)
-            {
-                eval_context<Json> this_context(context, this->keyword_name());
 
-                std::string message("Minimum number of properties is " + std::to_string(min_properties_));
-                message.append(" but found " + std::to_string(instance.size()));
-                walk_result result = reporter.error(this->make_validation_message(
-                    this_context.eval_path(),
-                    instance_location, 
-                    std::move(message)));
-                if (result == walk_result::abort)
-                {
-                    return result;
-                }
+            const std::size_t size = instance.size();
+            if (JSONCONS_LIKELY(size >= min_properties_))
+            {
+                return walk_result::advance;
             }
-            
-            return walk_result::advance;
+
+            eval_context<Json> this_context(context, this->keyword_name());
+            std::string message(message_);
+            jsoncons::detail::from_integer(size, message);
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                std::move(message)));
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -2124,7 +2330,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class conditional_validator : public keyword_validator<Json>
+    class conditional_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -2157,7 +2363,7 @@ namespace jsonschema {
         {
             if (if_val_) 
             {
-                collecting_error_listener local_reporter;
+                counting_error_listener local_reporter;
                 evaluation_results local_results;
                 
                 eval_context<Json> if_context(context, "if");
@@ -2171,7 +2377,7 @@ namespace jsonschema {
                 //{
                 //    std::cout << "  " << item << "\n";
                 //}
-                if (local_reporter.errors.empty()) 
+                if (local_reporter.error_count() == 0) 
                 {
                     results.merge(local_results);
                     if (then_val_)
@@ -2249,51 +2455,49 @@ namespace jsonschema {
     // enum_validator
 
     template <typename Json>
-    class enum_validator : public keyword_validator<Json>
+    class enum_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         Json value_;
+        // Hash of each enum value, in array order; comparing hashes first
+        // screens out non-matching candidates without full Json comparisons.
+        std::vector<std::size_t> hashes_;
 
     public:
         enum_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, const Json& sch)
             : keyword_validator<Json>("enum", schema, schema_location, custom_message), value_(sch)
         {
+            hashes_.reserve(value_.size());
+            for (const auto& item : value_.array_range())
+            {
+                hashes_.push_back(json_hash(item));
+            }
         }
 
     private:
 
-        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+        walk_result do_validate(const eval_context<Json>& context, const Json& instance,
             const jsonpointer::json_pointer& instance_location,
-            evaluation_results& /*results*/, 
+            evaluation_results& /*results*/,
             error_reporter& reporter,
             Json& /*patch*/) const final
         {
-            eval_context<Json> this_context(context, this->keyword_name());
-
-            bool in_range = false;
-            for (const auto& item : value_.array_range())
+            const std::size_t h = json_hash(instance);
+            for (std::size_t i = 0; i < hashes_.size(); ++i)
             {
-                if (item == instance) 
+                if (hashes_[i] == h && value_[i] == instance)
                 {
-                    in_range = true;
-                    break;
+                    return walk_result::advance;
                 }
             }
 
-            if (!in_range)
-            {
-                walk_result result = reporter.error(this->make_validation_message(
-                    this_context.eval_path(),
-                    instance_location, 
-                    "'" + instance.template as<std::string>() + "' is not a valid enum value."));
-                if (result == walk_result::abort)
-                {
-                    return result;
-                }
-            }
-            return walk_result::advance;
+            eval_context<Json> this_context(context, this->keyword_name());
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location,
+                "'" + instance.template as<std::string>() + "' is not a valid enum value."));
         }
 
         walk_result do_walk(const eval_context<Json>& /*context*/, const Json& instance,
@@ -2306,28 +2510,69 @@ namespace jsonschema {
     // const_validator
 
     template <typename Json>
-    class const_validator : public keyword_validator<Json>
+    class const_validator final : public keyword_validator<Json>
     {        
         using keyword_validator_ptr_type = std::unique_ptr<keyword_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
+        // null, bool and plain string consts - the common cases - compare
+        // with a type check and at most one string comparison; numbers keep
+        // the generic comparison, whose cross-type equality (int64, uint64,
+        // double, bignum) is not worth duplicating here.
+        enum class const_kind : uint8_t {generic, null_value, bool_value, string_value};
+
         Json value_;
+        const_kind kind_;
 
     public:
         const_validator(const Json& schema, const uri& schema_location, const std::string& custom_message, const Json& sch)
             : keyword_validator<Json>("const", schema, schema_location, custom_message), value_(sch)
         {
+            switch (value_.type())
+            {
+                case json_type::null_value:
+                    kind_ = const_kind::null_value;
+                    break;
+                case json_type::bool_value:
+                    kind_ = const_kind::bool_value;
+                    break;
+                case json_type::string_value:
+                    kind_ = value_.tag() == semantic_tag::none ? const_kind::string_value : const_kind::generic;
+                    break;
+                default:
+                    kind_ = const_kind::generic;
+                    break;
+            }
         }
 
     private:
 
-        walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
+        bool matches(const Json& instance) const
+        {
+            switch (kind_)
+            {
+                case const_kind::null_value:
+                    return instance.is_null();
+                case const_kind::bool_value:
+                    return instance.type() == json_type::bool_value && instance.as_bool() == value_.as_bool();
+                case const_kind::string_value:
+                    if (instance.type() == json_type::string_value && instance.tag() == semantic_tag::none)
+                    {
+                        return instance.as_string_view() == value_.as_string_view();
+                    }
+                    return value_ == instance;
+                default:
+                    return value_ == instance;
+            }
+        }
+
+        walk_result do_validate(const eval_context<Json>& context, const Json& instance,
             const jsonpointer::json_pointer& instance_location,
-            evaluation_results& /*results*/, 
+            evaluation_results& /*results*/,
             error_reporter& reporter,
             Json& /*patch*/) const final
         {
-            if (value_ != instance)
+            if (!matches(instance))
             {
                 eval_context<Json> this_context(context, this->keyword_name());
 
@@ -2378,12 +2623,17 @@ namespace jsonschema {
     }
 
     template <typename Json>
-    class type_validator : public keyword_validator<Json>
+    class type_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
         std::vector<json_schema_type> expected_types_;
+        // Bit per expected json_schema_type, so the common single-type check
+        // is one switch on the instance type and a mask test instead of a
+        // loop. The vector is kept for failure messages, which list the
+        // expected types in schema order.
+        uint8_t expected_mask_;
 
     public:
         type_validator(const type_validator&) = delete;
@@ -2394,8 +2644,12 @@ namespace jsonschema {
         type_validator(const Json& schema, const uri& schema_location, const std::string& custom_message,
             std::vector<json_schema_type>&& expected_types)
             : keyword_validator<Json>("type", schema, std::move(schema_location), custom_message),
-              expected_types_(std::move(expected_types))
+              expected_types_(std::move(expected_types)), expected_mask_(0)
         {
+            for (auto expected_type : expected_types_)
+            {
+                expected_mask_ |= type_bit(expected_type);
+            }
         }
 
     private:
@@ -2406,69 +2660,56 @@ namespace jsonschema {
             error_reporter& reporter, 
             Json& /*patch*/) const final
         {
-            //std::cout << "type_validator.do_validate " << context.eval_path().string() << instance << "\n";
-            //for (auto& type : expected_types_ )
-            //{
-            //    std::cout << "    " << to_string(type) << "\n";
-            //}
-
-            eval_context<Json> this_context(context, this->keyword_name());
-
             bool is_type_found = expected_types_.empty();
 
-            auto end = expected_types_.end();
-            for (auto it = expected_types_.begin(); it != end && !is_type_found; ++it)
+            if (!is_type_found)
             {
-                switch (*it)
+                switch (instance.type())
                 {
-                    case json_schema_type::null:
-                        if (instance.is_null()) // OK
-                        {
-                            is_type_found = true;
-                        }
+                    case json_type::null_value:
+                        is_type_found = (expected_mask_ & type_bit(json_schema_type::null)) != 0;
                         break;
-                    case json_schema_type::object:
-                        if (instance.is_object()) // OK
-                        {
-                            is_type_found = true;
-                        }
+                    case json_type::object_value:
+                        is_type_found = (expected_mask_ & type_bit(json_schema_type::object)) != 0;
                         break;
-                    case json_schema_type::array:
-                        if (instance.is_array())  // OK
-                        {
-                            is_type_found = true;
-                        }
+                    case json_type::array_value:
+                        is_type_found = (expected_mask_ & type_bit(json_schema_type::array)) != 0;
                         break;
-                    case json_schema_type::string:  // OK
-                        if (instance.is_string() && instance.tag() != semantic_tag::bigint)
-                        {
-                            is_type_found = true;
-                        }
+                    case json_type::bool_value:
+                        is_type_found = (expected_mask_ & type_bit(json_schema_type::boolean)) != 0;
                         break;
-                    case json_schema_type::boolean: // OK
-                        if (instance.is_bool())
-                        {
-                            is_type_found = true;
-                        }
+                    case json_type::int64_value:
+                    case json_type::uint64_value:
+                        is_type_found = (expected_mask_ & (type_bit(json_schema_type::integer) | type_bit(json_schema_type::number))) != 0;
                         break;
-                    case json_schema_type::integer:
-                        if (instance.is_int64() || instance.is_uint64())
-                        {
-                            is_type_found = true;
-                        }
-                        else if (instance.is_double() && static_cast<double>(instance.template as<int64_t>()) == instance.template as<double>())
+                    case json_type::half_value:
+                        is_type_found = (expected_mask_ & type_bit(json_schema_type::number)) != 0;
+                        break;
+                    case json_type::double_value:
+                        // Preserves the schema-order semantics of checking
+                        // "integer" (integral-valued) against "number".
+                        for (auto it = expected_types_.begin(); it != expected_types_.end() && !is_type_found; ++it)
                         {
-                            is_type_found = true;
+                            if (*it == json_schema_type::number)
+                            {
+                                is_type_found = true;
+                            }
+                            else if (*it == json_schema_type::integer &&
+                                static_cast<double>(instance.template as<int64_t>()) == instance.template as<double>())
+                            {
+                                is_type_found = true;
+                            }
                         }
-                        else if (instance.is_string() && instance.tag() == semantic_tag::bigint)
+                        break;
+                    case json_type::string_value:
+                        if (instance.tag() == semantic_tag::bigint)
                         {
-                            is_type_found = true;
+                            is_type_found = (expected_mask_ & (type_bit(json_schema_type::integer) | type_bit(json_schema_type::number))) != 0;
                         }
-                        break;
-                    case json_schema_type::number:
-                        if (instance.is_number())
+                        else
                         {
-                            is_type_found = true;
+                            is_type_found = (expected_mask_ & type_bit(json_schema_type::string)) != 0 ||
+                                (instance.is_number() && (expected_mask_ & type_bit(json_schema_type::number)) != 0);
                         }
                         break;
                     default:
@@ -2476,30 +2717,38 @@ namespace jsonschema {
                 }
             }
 
-            if (!is_type_found)
+            if (JSONCONS_LIKELY(is_type_found))
             {
-                std::string message = "Expected ";
-                for (std::size_t i = 0; i < expected_types_.size(); ++i)
-                {
-                        if (i > 0)
+                return walk_result::advance;
+            }
+
+            eval_context<Json> this_context(context, this->keyword_name());
+
+            std::string message = "Expected ";
+            for (std::size_t i = 0; i < expected_types_.size(); ++i)
+            {
+                    if (i > 0)
+                    { 
+                        message.append(", ");
+                        if (i+1 == expected_types_.size())
                         { 
-                            message.append(", ");
-                            if (i+1 == expected_types_.size())
-                            { 
-                                message.append("or ");
-                            }
+                            message.append("or ");
                         }
-                        message.append(to_string(expected_types_[i]));
-                }
-                message.append(", found ");
-                message.append(to_schema_type(instance.type()));
-
-                return reporter.error(this->make_validation_message(
-                    this_context.eval_path(),
-                    instance_location, 
-                    message));
+                    }
+                    message.append(to_string(expected_types_[i]));
             }
-            return walk_result::advance;
+            message.append(", found ");
+            message.append(to_schema_type(instance.type()));
+
+            return reporter.error(this->make_validation_message(
+                this_context.eval_path(),
+                instance_location, 
+                message));
+        }
+
+        static constexpr uint8_t type_bit(json_schema_type type)
+        {
+            return static_cast<uint8_t>(uint8_t(1) << static_cast<uint8_t>(type));
         }
         
         std::string to_schema_type(json_type type) const
@@ -2551,13 +2800,18 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class properties_validator : public keyword_validator<Json>
+    class properties_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
-        std::map<std::string, schema_validator_ptr_type> properties_;
+        using property_type = std::pair<std::string, schema_validator_ptr_type>;
+
+        std::vector<property_type> properties_;
+        // Indices of properties whose schemas carry a "default", so the
+        // default-fill pass can be skipped entirely when there are none.
+        std::vector<std::size_t> properties_with_defaults_;
     public:
         properties_validator(const properties_validator&) = delete;
         properties_validator& operator=(const properties_validator&) = delete;
@@ -2566,9 +2820,20 @@ namespace jsonschema {
 
         properties_validator(const Json& schema, const uri& schema_location, const std::string& custom_message,
             std::map<std::string, schema_validator_ptr_type>&& properties)
-            : keyword_validator<Json>("properties", schema, std::move(schema_location), custom_message),
-              properties_(std::move(properties))
+            : keyword_validator<Json>("properties", schema, std::move(schema_location), custom_message)
         {
+            properties_.reserve(properties.size());
+            for (auto& member : properties)
+            {
+                properties_.emplace_back(member.first, std::move(member.second));
+            }
+            for (std::size_t i = 0; i < properties_.size(); ++i)
+            {
+                if (properties_[i].second->get_default_value())
+                {
+                    properties_with_defaults_.push_back(i);
+                }
+            }
         }
 
         walk_result validate(const eval_context<Json>& context, const Json& instance, 
@@ -2593,15 +2858,31 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
+            // Marks the properties seen in the instance so the default-fill
+            // pass below needs no lookups of its own.
+            std::vector<uint64_t> seen;
+            if (!properties_with_defaults_.empty())
+            {
+                seen.resize((properties_.size() + 63)/64, 0);
+            }
+
+            // Reused as a push/pop path stack to avoid copying the leading
+            // tokens for every member.
+            jsonpointer::json_pointer prop_location = instance_location;
             for (const auto& prop : instance.object_range()) 
             {
-                auto prop_it = properties_.find(prop.key());
+                auto prop_it = find_property(prop.key());
 
                 // check if it is in "properties"
                 if (prop_it != properties_.end()) 
                 {
+                    if (!seen.empty())
+                    {
+                        std::size_t i = static_cast<std::size_t>(prop_it - properties_.begin());
+                        seen[i >> 6] |= uint64_t(1) << (i & 63);
+                    }
                     eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                    jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                    prop_location /= prop.key();
 
                     std::size_t errors = reporter.error_count();
                     walk_result result = (*prop_it).second->validate(prop_context, prop.value(), prop_location, results, reporter, patch);
@@ -2609,6 +2890,7 @@ namespace jsonschema {
                     {
                         return result;
                     }
+                    prop_location.pop_back();
                     allowed_properties.insert(prop.key());
                     if (errors == reporter.error_count())
                     {
@@ -2621,22 +2903,18 @@ namespace jsonschema {
             }
             // Any property that doesn't match any of the property names in the properties keyword is ignored by this keyword.
 
-            // reverse search
-            for (auto const& prop : properties_) 
+            // Fill in defaults for properties that were not seen in the
+            // instance; the bitset from the loop above replaces a find per
+            // declared property.
+            for (std::size_t i : properties_with_defaults_)
             {
-                //std::cout << "   prop:" << prop.first << "\n";
-                const auto finding = instance.find(prop.first);
-                if (finding == instance.object_range().end()) 
-                { 
-                    // If prop is not in instance
-                    auto default_value = prop.second->get_default_value();
-                    if (default_value) 
-                    { 
-                        // If default value is available, update patch
-                        jsonpointer::json_pointer prop_location = instance_location / prop.first;
+                if ((seen[i >> 6] & (uint64_t(1) << (i & 63))) == 0)
+                {
+                    auto default_value = properties_[i].second->get_default_value();
 
-                        update_patch(patch, prop_location, std::move(*default_value));
-                    }
+                    // If default value is available, update patch
+                    jsonpointer::json_pointer default_location = instance_location / properties_[i].first;
+                    update_patch(patch, default_location, std::move(*default_value));
                 }
             }
             //std::cout << "properties_validator end[" << context.eval_path().string() << "," << this->schema_location().string() << "]";
@@ -2664,19 +2942,21 @@ namespace jsonschema {
                 return result;
             }
 
+            jsonpointer::json_pointer prop_location = instance_location;
             for (const auto& prop : instance.object_range()) 
             {
-                auto prop_it = properties_.find(prop.key());
+                auto prop_it = find_property(prop.key());
 
                 if (prop_it != properties_.end()) 
                 {
-                    jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                    prop_location /= prop.key();
                     result = (*prop_it).second->walk(context, prop.value(), prop_location, reporter);
                     allowed_properties.insert(prop.key());
                     if (result == walk_result::abort)
                     {
                         return result;
                     }
+                    prop_location.pop_back();
                 }
             }
             return walk_result::advance;
@@ -2684,6 +2964,24 @@ namespace jsonschema {
 
     private:
 
+        // Keys are in std::map order, so the vector is sorted. Schemas usually
+        // have few properties, where a linear scan beats binary search.
+        typename std::vector<property_type>::const_iterator find_property(const std::string& key) const
+        {
+            if (properties_.size() <= 8)
+            {
+                auto it = properties_.begin();
+                while (it != properties_.end() && (*it).first != key)
+                {
+                    ++it;
+                }
+                return it;
+            }
+            auto it = std::lower_bound(properties_.begin(), properties_.end(), key,
+                [](const property_type& item, const std::string& k) {return item.first < k;});
+            return (it != properties_.end() && (*it).first == key) ? it : properties_.end();
+        }
+
         walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
             const jsonpointer::json_pointer& instance_location,
             evaluation_results& results, 
@@ -2712,20 +3010,42 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class pattern_properties_validator : public keyword_validator<Json>
+    class pattern_properties_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
-        std::vector<std::pair<std::regex, schema_validator_ptr_type>> pattern_properties_;
+        std::vector<std::pair<string_pattern, schema_validator_ptr_type>> pattern_properties_;
+        // Pattern indices matching each name declared under "properties" in the
+        // same schema object, computed once at build time so instance keys that
+        // hit a declared property never run the regex engine.
+        std::unordered_map<std::string, std::vector<std::size_t>> known_property_matches_;
 
     public:
         pattern_properties_validator(const Json& schema, const uri& schema_location, const std::string& custom_message,
-            std::vector<std::pair<std::regex, schema_validator_ptr_type>>&& pattern_properties)
+            std::vector<std::pair<string_pattern, schema_validator_ptr_type>>&& pattern_properties)
             : keyword_validator<Json>("patternProperties", schema, std::move(schema_location), custom_message),
               pattern_properties_(std::move(pattern_properties))
         {
+#if defined(JSONCONS_HAS_STD_REGEX)
+            auto it = schema.find("properties");
+            if (it != schema.object_range().end() && (*it).value().is_object())
+            {
+                for (const auto& prop : (*it).value().object_range())
+                {
+                    std::vector<std::size_t> matches;
+                    for (std::size_t i = 0; i < pattern_properties_.size(); ++i)
+                    {
+                        if (pattern_properties_[i].first.search(prop.key()))
+                        {
+                            matches.push_back(i);
+                        }
+                    }
+                    known_property_matches_.emplace(prop.key(), std::move(matches));
+                }
+            }
+#endif
         }
 
         walk_result validate(const eval_context<Json>& context, const Json& instance, 
@@ -2748,32 +3068,36 @@ namespace jsonschema {
                 return walk_result::advance;
             }
             eval_context<Json> this_context(context, this->keyword_name());
-            for (const auto& prop : instance.object_range()) 
+            std::vector<std::size_t> scratch;
+            jsonpointer::json_pointer prop_location = instance_location;
+            for (const auto& prop : instance.object_range())
             {
+                // find all matching "patternProperties"
+                const std::vector<std::size_t>* matched = match_patterns(prop.key(), scratch);
+                if (matched->empty())
+                {
+                    continue;
+                }
                 eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                jsonpointer::json_pointer prop_location = instance_location / prop.key();
-
-                // check all matching "patternProperties"
-                for (auto& schema_pp : pattern_properties_)
+                prop_location /= prop.key();
+                allowed_properties.insert(prop.key());
+                for (std::size_t index : *matched)
                 {
-                    if (std::regex_search(prop.key(), schema_pp.first)) 
+                    std::size_t errors = reporter.error_count();
+                    walk_result result = pattern_properties_[index].second->validate(prop_context, prop.value() , prop_location, results, reporter, patch);
+                    if (result == walk_result::abort)
                     {
-                        allowed_properties.insert(prop.key());
-                        std::size_t errors = reporter.error_count();
-                        walk_result result = schema_pp.second->validate(prop_context, prop.value() , prop_location, results, reporter, patch);
-                        if (result == walk_result::abort)
-                        {
-                            return result;
-                        }
-                        if (errors == reporter.error_count())
+                        return result;
+                    }
+                    if (errors == reporter.error_count())
+                    {
+                        if (context.require_evaluated_properties())
                         {
-                            if (context.require_evaluated_properties())
-                            {
-                                results.evaluated_properties.insert(prop.key());
-                            }
+                            results.evaluated_properties.insert(prop.key());
                         }
                     }
                 }
+                prop_location.pop_back();
             }
 #endif
             return walk_result::advance;
@@ -2795,24 +3119,28 @@ namespace jsonschema {
             (void)context;
 #if defined(JSONCONS_HAS_STD_REGEX)
             eval_context<Json> this_context(context, this->keyword_name());
-            for (const auto& prop : instance.object_range()) 
+            std::vector<std::size_t> scratch;
+            jsonpointer::json_pointer prop_location = instance_location;
+            for (const auto& prop : instance.object_range())
             {
+                // find all matching "patternProperties"
+                const std::vector<std::size_t>* matched = match_patterns(prop.key(), scratch);
+                if (matched->empty())
+                {
+                    continue;
+                }
                 eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                jsonpointer::json_pointer prop_location = instance_location / prop.key();
-
-                // check all matching "patternProperties"
-                for (auto& schema_pp : pattern_properties_)
+                prop_location /= prop.key();
+                allowed_properties.insert(prop.key());
+                for (std::size_t index : *matched)
                 {
-                    if (std::regex_search(prop.key(), schema_pp.first)) 
+                    result = pattern_properties_[index].second->walk(prop_context, prop.value() , prop_location, reporter);
+                    if (result == walk_result::abort)
                     {
-                        allowed_properties.insert(prop.key());
-                        result = schema_pp.second->walk(prop_context, prop.value() , prop_location, reporter);
-                        if (result == walk_result::abort)
-                        {
-                            return result;
-                        }
+                        return result;
                     }
                 }
+                prop_location.pop_back();
             }
 #endif
             return walk_result::advance;
@@ -2820,6 +3148,29 @@ namespace jsonschema {
 
     private:
 
+#if defined(JSONCONS_HAS_STD_REGEX)
+        // Returns the indices of the patterns that match key, using the
+        // precomputed table for names declared under "properties" and the
+        // regex engine (into scratch) otherwise.
+        const std::vector<std::size_t>* match_patterns(const std::string& key, std::vector<std::size_t>& scratch) const
+        {
+            auto known_it = known_property_matches_.find(key);
+            if (known_it != known_property_matches_.end())
+            {
+                return &known_it->second;
+            }
+            scratch.clear();
+            for (std::size_t i = 0; i < pattern_properties_.size(); ++i)
+            {
+                if (pattern_properties_[i].first.search(key))
+                {
+                    scratch.push_back(i);
+                }
+            }
+            return &scratch;
+        }
+#endif
+
         walk_result do_validate(const eval_context<Json>& context, const Json& instance, 
             const jsonpointer::json_pointer& instance_location,
             evaluation_results& results, 
@@ -2839,7 +3190,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class additional_properties_validator : public keyword_validator<Json>
+    class additional_properties_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -2905,16 +3256,22 @@ namespace jsonschema {
                 {
                     for (const auto& prop : instance.object_range()) 
                     {
-                        eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                        jsonpointer::json_pointer prop_location = instance_location / prop.key();
                         // check if it is in "allowed properties"
                         auto prop_it = allowed_properties.find(prop.key());
                         if (prop_it == allowed_properties.end()) 
                         {
+                            eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
+                            jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                            // Sized once; a + chain would allocate per operand.
+                            std::string message;
+                            message.reserve(45 + prop.key().size());
+                            message.append("Additional property '");
+                            message.append(prop.key());
+                            message.append("' not allowed by schema.");
                             walk_result result = reporter.error(this->make_validation_message(
                                 prop_context.eval_path(),
-                                prop_location, 
-                                "Additional property '" + prop.key() + "' not allowed by schema."));
+                                prop_location,
+                                std::move(message)));
                             if (result == walk_result::abort)
                             {
                                 return result;
@@ -2935,6 +3292,7 @@ namespace jsonschema {
                 }
                 else
                 {
+                    jsonpointer::json_pointer prop_location = instance_location;
                     for (const auto& prop : instance.object_range()) 
                     {
                         // check if it is in "allowed properties"
@@ -2942,25 +3300,28 @@ namespace jsonschema {
                         if (prop_it == allowed_properties.end()) 
                         {
                             eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                            jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                            prop_location /= prop.key();
 
                             // finally, check "additionalProperties" 
-                            //std::cout << "additional_properties_validator a_prop_or_pattern_matched " << a_prop_or_pattern_matched << ", " << bool(additional_properties_);
-                            
-                            //std::cout << " !!!additionalProperties!!!";
-                            collecting_error_listener local_reporter;
+                            counting_error_listener local_reporter;
 
                             walk_result result = additional_properties_->validate(prop_context, prop.value() , prop_location, results, local_reporter, patch);
                             if (result == walk_result::abort)
                             {
                                 return result;
                             }
-                            if (!local_reporter.errors.empty())
+                            prop_location.pop_back();
+                            if (local_reporter.error_count() > 0)
                             {
+                                std::string message;
+                                message.reserve(46 + prop.key().size());
+                                message.append("Additional property '");
+                                message.append(prop.key());
+                                message.append("' found but was invalid.");
                                 result = reporter.error(this->make_validation_message(
                                     this_context.eval_path(),
-                                    instance_location, 
-                                    "Additional property '" + prop.key() + "' found but was invalid."));
+                                    instance_location,
+                                    std::move(message)));
                                 if (result == walk_result::abort)
                                 {
                                     return result;
@@ -3014,6 +3375,7 @@ namespace jsonschema {
             if (additional_properties_)
             {
                 eval_context<Json> this_context(context, this->keyword_name());
+                jsonpointer::json_pointer prop_location = instance_location;
                 for (const auto& prop : instance.object_range()) 
                 {
                     // check if it is in "allowed properties"
@@ -3021,13 +3383,14 @@ namespace jsonschema {
                     if (prop_it == allowed_properties.end()) 
                     {
                         eval_context<Json> prop_context{this_context, prop.key(), evaluation_flags{}};
-                        jsonpointer::json_pointer prop_location = instance_location / prop.key();
+                        prop_location /= prop.key();
 
                         result = additional_properties_->walk(prop_context, prop.value() , prop_location, reporter);
                         if (result == walk_result::abort)
                         {
                             return result;
                         }
+                        prop_location.pop_back();
                     }
                 }
             }
@@ -3036,13 +3399,15 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class dependent_required_validator : public keyword_validator<Json>
+    class dependent_required_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
-        std::map<std::string, keyword_validator_ptr_type> dependent_required_;
+        // Sorted by key; a map's node hops are a poor fit for the lookup
+        // per instance member below.
+        std::vector<std::pair<std::string, keyword_validator_ptr_type>> dependent_required_;
 
     public:
         dependent_required_validator(const Json& schema, const uri& schema_location,
@@ -3050,9 +3415,13 @@ namespace jsonschema {
             const std::string& custom_message = std::string{}
         )
             : keyword_validator<Json>("dependentRequired", schema, std::move(schema_location),
-                custom_message), 
-              dependent_required_(std::move(dependent_required))
+                custom_message)
         {
+            dependent_required_.reserve(dependent_required.size());
+            for (auto& member : dependent_required)
+            {
+                dependent_required_.emplace_back(member.first, std::move(member.second));
+            }
         }
 
     private:
@@ -3070,14 +3439,17 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            for (const auto& dep : dependent_required_) 
+            // One pass over the instance, each member keying into the sorted
+            // dependency table, instead of a find in the instance per
+            // dependency.
+            for (const auto& prop : instance.object_range())
             {
-                auto prop = instance.find(dep.first);
-                if (prop != instance.object_range().end()) 
+                auto dep = find_member(dependent_required_, prop.key());
+                if (dep != dependent_required_.end())
                 {
                     // if dependency-prop is present in instance
-                    jsonpointer::json_pointer prop_location = instance_location / dep.first;
-                    walk_result result = dep.second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
+                    jsonpointer::json_pointer prop_location = instance_location / (*dep).first;
+                    walk_result result = (*dep).second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
                     if (result == walk_result::abort)
                     {
                         return result;
@@ -3103,13 +3475,13 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            for (const auto& dep : dependent_required_) 
+            for (const auto& prop : instance.object_range())
             {
-                auto prop = instance.find(dep.first);
-                if (prop != instance.object_range().end()) 
+                auto dep = find_member(dependent_required_, prop.key());
+                if (dep != dependent_required_.end())
                 {
                     // if dependency-prop is present in instance
-                    result = dep.second->walk(this_context, instance, instance_location / dep.first, reporter); 
+                    result = (*dep).second->walk(this_context, instance, instance_location / (*dep).first, reporter);
                     if (result == walk_result::abort)
                     {
                         return result;
@@ -3121,13 +3493,14 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class dependent_schemas_validator : public keyword_validator<Json>
+    class dependent_schemas_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
-        std::map<std::string, schema_validator_ptr_type> dependent_schemas_;
+        // Sorted by key, see dependent_required_validator.
+        std::vector<std::pair<std::string, schema_validator_ptr_type>> dependent_schemas_;
 
     public:
         dependent_schemas_validator(const Json& schema, const uri& schema_location,
@@ -3135,9 +3508,13 @@ namespace jsonschema {
             std::map<std::string, schema_validator_ptr_type>&& dependent_schemas
         )
             : keyword_validator<Json>("dependentSchemas", schema, std::move(schema_location),
-                custom_message), 
-              dependent_schemas_(std::move(dependent_schemas))
+                custom_message)
         {
+            dependent_schemas_.reserve(dependent_schemas.size());
+            for (auto& member : dependent_schemas)
+            {
+                dependent_schemas_.emplace_back(member.first, std::move(member.second));
+            }
         }
 
     private:
@@ -3155,14 +3532,14 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            for (const auto& dep : dependent_schemas_) 
+            for (const auto& prop : instance.object_range())
             {
-                auto prop = instance.find(dep.first);
-                if (prop != instance.object_range().end()) 
+                auto dep = find_member(dependent_schemas_, prop.key());
+                if (dep != dependent_schemas_.end())
                 {
                     // if dependency-prop is present in instance
-                    jsonpointer::json_pointer prop_location = instance_location / dep.first;
-                    walk_result result = dep.second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
+                    jsonpointer::json_pointer prop_location = instance_location / (*dep).first;
+                    walk_result result = (*dep).second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
                     if (result == walk_result::abort)
                     {
                         return result;
@@ -3187,13 +3564,13 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            for (const auto& dep : dependent_schemas_) 
+            for (const auto& prop : instance.object_range())
             {
-                auto prop = instance.find(dep.first);
-                if (prop != instance.object_range().end()) 
+                auto dep = find_member(dependent_schemas_, prop.key());
+                if (dep != dependent_schemas_.end())
                 {
                     // if dependency-prop is present in instance
-                    result = dep.second->walk(this_context, instance, instance_location / dep.first, reporter);
+                    result = (*dep).second->walk(this_context, instance, instance_location / (*dep).first, reporter);
                     if (result == walk_result::abort)
                     {
                         return result;
@@ -3205,7 +3582,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class property_names_validator : public keyword_validator<Json>
+    class property_names_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -3298,14 +3675,15 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class dependencies_validator : public keyword_validator<Json>
+    class dependencies_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
 
-        std::map<std::string, keyword_validator_ptr_type> dependent_required_;
-        std::map<std::string, schema_validator_ptr_type> dependent_schemas_;
+        // Sorted by key, see dependent_required_validator.
+        std::vector<std::pair<std::string, keyword_validator_ptr_type>> dependent_required_;
+        std::vector<std::pair<std::string, schema_validator_ptr_type>> dependent_schemas_;
 
     public:
         dependencies_validator(const Json& schema, const uri& schema_location,
@@ -3314,10 +3692,18 @@ namespace jsonschema {
             const std::string& custom_message = std::string{}
         )
             : keyword_validator<Json>("dependencies", schema, std::move(schema_location),
-                custom_message), 
-              dependent_required_(std::move(dependent_required)),
-              dependent_schemas_(std::move(dependent_schemas))
+                custom_message)
         {
+            dependent_required_.reserve(dependent_required.size());
+            for (auto& member : dependent_required)
+            {
+                dependent_required_.emplace_back(member.first, std::move(member.second));
+            }
+            dependent_schemas_.reserve(dependent_schemas.size());
+            for (auto& member : dependent_schemas)
+            {
+                dependent_schemas_.emplace_back(member.first, std::move(member.second));
+            }
         }
 
     private:
@@ -3335,29 +3721,30 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
 
-            for (const auto& dep : dependent_required_) 
+            // A dependency key maps to either a required list or a schema,
+            // never both, so a single pass over the instance covers the two
+            // tables.
+            for (const auto& prop : instance.object_range())
             {
-                auto prop = instance.find(dep.first);
-                if (prop != instance.object_range().end()) 
+                auto dep_required = find_member(dependent_required_, prop.key());
+                if (dep_required != dependent_required_.end())
                 {
                     // if dependency-prop is present in instance
-                    jsonpointer::json_pointer prop_location = instance_location / dep.first;
-                    walk_result result = dep.second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
+                    jsonpointer::json_pointer prop_location = instance_location / (*dep_required).first;
+                    walk_result result = (*dep_required).second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
                     if (result == walk_result::abort)
                     {
                         return result;
                     }
+                    continue;
                 }
-            }
 
-            for (const auto& dep : dependent_schemas_) 
-            {
-                auto prop = instance.find(dep.first);
-                if (prop != instance.object_range().end()) 
+                auto dep_schema = find_member(dependent_schemas_, prop.key());
+                if (dep_schema != dependent_schemas_.end())
                 {
                     // if dependency-prop is present in instance
-                    jsonpointer::json_pointer prop_location = instance_location / dep.first;
-                    walk_result result = dep.second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
+                    jsonpointer::json_pointer prop_location = instance_location / (*dep_schema).first;
+                    walk_result result = (*dep_schema).second->validate(this_context, instance, prop_location, results, reporter, patch); // validate
                     if (result == walk_result::abort)
                     {
                         return result;
@@ -3396,8 +3783,11 @@ namespace jsonschema {
 
             if (count > max_value_)
             {
-                std::string message("A schema can match a contains constraint at most " + std::to_string(max_value_) + " times");
-                message.append(" but it matched " + std::to_string(count) + " times.");
+                std::string message("A schema can match a contains constraint at most ");
+                jsoncons::detail::from_integer(max_value_, message);
+                message.append(" times but it matched ");
+                jsoncons::detail::from_integer(count, message);
+                message.append(" times.");
                 
                 walk_result result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
@@ -3443,8 +3833,11 @@ namespace jsonschema {
 
             if (count < min_value_)
             {
-                std::string message("A schema must match a contains constraint at least " + std::to_string(min_value_) + " times");
-                message.append(" but it matched " + std::to_string(count) + " times.");
+                std::string message("A schema must match a contains constraint at least ");
+                jsoncons::detail::from_integer(min_value_, message);
+                message.append(" times but it matched ");
+                jsoncons::detail::from_integer(count, message);
+                message.append(" times.");
                 walk_result result = reporter.error(this->make_validation_message(
                     this_context.eval_path(),
                     instance_location, 
@@ -3465,7 +3858,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class contains_validator : public keyword_validator<Json>
+    class contains_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -3508,20 +3901,23 @@ namespace jsonschema {
             eval_context<Json> this_context(context, this->keyword_name());
 
             std::size_t contains_count = 0;
-            collecting_error_listener local_reporter;
+            first_error_collecting_listener local_reporter;
 
             std::size_t index = 0;
             std::size_t start = 0;
             std::size_t end = 0;
-            for (const auto& item : instance.array_range()) 
+            jsonpointer::json_pointer item_location = instance_location;
+            for (const auto& item : instance.array_range())
             {
-                std::size_t errors = local_reporter.errors.size();
-                walk_result result = schema_validator_->validate(this_context, item, instance_location / index, results, local_reporter, patch);
+                std::size_t error_count = local_reporter.error_count();
+                item_location /= index;
+                walk_result result = schema_validator_->validate(this_context, item, item_location, results, local_reporter, patch);
                 if (result == walk_result::abort)
                 {
                     return result;
                 }
-                if (errors == local_reporter.errors.size())
+                item_location.pop_back();
+                if (error_count == local_reporter.error_count())
                 {
                     if (context.require_evaluated_items())
                     {
@@ -3532,6 +3928,12 @@ namespace jsonschema {
                         ++end;
                     }
                     ++contains_count;
+                    // One matching item settles the keyword unless the match
+                    // count or the evaluated-item ranges are still needed.
+                    if (!max_contains_ && !min_contains_ && !context.require_evaluated_items())
+                    {
+                        break;
+                    }
                 }
                 else
                 {
@@ -3604,13 +4006,16 @@ namespace jsonschema {
 
             eval_context<Json> this_context(context, this->keyword_name());
             
+            jsonpointer::json_pointer item_location = instance_location;
             for (std::size_t index = 0; index < instance.size(); ++index)
             {
-                result = schema_validator_->walk(this_context, instance.at(index), instance_location / index, reporter);
+                item_location /= index;
+                result = schema_validator_->walk(this_context, instance.at(index), item_location, reporter);
                 if (result == walk_result::abort)
                 {
                     return result;
                 }
+                item_location.pop_back();
             }
 
             if (max_contains_)
@@ -3754,7 +4159,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class prefix_items_validator : public keyword_validator<Json>
+    class prefix_items_validator final : public keyword_validator<Json>
     {
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
@@ -3882,7 +4287,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class unevaluated_properties_validator : public keyword_validator<Json>
+    class unevaluated_properties_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -3994,7 +4399,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class unevaluated_items_validator : public keyword_validator<Json>
+    class unevaluated_items_validator final : public keyword_validator<Json>
     {
         using keyword_validator_ptr_type = typename keyword_validator<Json>::keyword_validator_ptr_type;
         using schema_validator_ptr_type = typename schema_validator<Json>::schema_validator_ptr_type;
@@ -43,7 +43,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class document_schema_validator : public schema_validator<Json>
+    class document_schema_validator final : public schema_validator<Json>
     {
         using schema_validator_ptr_type = std::unique_ptr<schema_validator<Json>>;
         using walk_reporter_type = typename json_schema_traits<Json>::walk_reporter_type;
@@ -132,7 +132,7 @@ namespace jsonschema {
     };
 
     template <typename Json>
-    class boolean_schema_validator : public schema_validator<Json>
+    class boolean_schema_validator final : public schema_validator<Json>
     {
     public:
         using schema_validator_ptr_type = typename std::unique_ptr<schema_validator<Json>>;
@@ -222,7 +222,7 @@ namespace jsonschema {
     };
  
     template <typename Json>
-    class object_schema_validator : public schema_validator<Json>
+    class object_schema_validator final : public schema_validator<Json>
     {
     public:
         using schema_validator_ptr_type = typename std::unique_ptr<schema_validator<Json>>;
@@ -50,7 +50,6 @@ namespace jsonschema {
         explicit uri_wrapper(const uri& uri)
             : uri_{uri}
         {
-            uri_ = jsoncons::uri(uri);
             if (!uri_.encoded_fragment().empty())
             {
                 identifier_ = uri_.fragment();
@@ -64,17 +63,17 @@ namespace jsonschema {
             }
         }
 
-        const jsoncons::uri& uri() const
+        const jsoncons::uri& uri() const noexcept
         {
             return uri_;
         }
 
-        bool has_fragment() const
+        bool has_fragment() const noexcept
         {
             return !uri_.encoded_fragment().empty();
         }
 
-        bool has_plain_name_fragment() const
+        bool has_plain_name_fragment() const noexcept
         {
             return has_plain_name_fragment_;
         }
@@ -89,24 +88,19 @@ namespace jsonschema {
             return uri_.path();
         }
 
-        bool is_absolute() const
+        bool is_absolute() const noexcept
         {
             return uri_.is_absolute();
         }
 
-        std::string fragment() const
+        const std::string& fragment() const noexcept
         {
             return identifier_;
         }
 
-        int compare(const uri_wrapper& other) const
+        int compare(const uri_wrapper& other) const noexcept
         {
-            int result = uri_.compare(other.uri_);
-            if (result != 0) 
-            {
-                return result;
-            }
-            return result; 
+            return uri_.compare(other.uri_);
         }
 
         uri_wrapper append(const std::string& field) const
@@ -118,8 +112,11 @@ namespace jsonschema {
             pointer /= field;
 
             jsoncons::uri new_uri(uri_, uri_fragment_part, pointer.to_string());
+            std::string identifier = new_uri.fragment();
 
-            return uri_wrapper(std::move(new_uri));
+            // The fragment was just built as a JSON Pointer, so it is never
+            // a plain name anchor; no need to parse it again to find out.
+            return uri_wrapper(std::move(new_uri), std::move(identifier), false);
         }
 
         uri_wrapper append(std::size_t index) const
@@ -131,46 +128,53 @@ namespace jsonschema {
             pointer /= index;
 
             jsoncons::uri new_uri(uri_, uri_fragment_part, pointer.to_string());
+            std::string identifier = new_uri.fragment();
 
-            return uri_wrapper(std::move(new_uri));
+            return uri_wrapper(std::move(new_uri), std::move(identifier), false);
         }
 
-        std::string string() const
+        const std::string& string() const noexcept
         {
-            std::string s = uri_.string();
-            return s;
+            return uri_.string();
         }
 
-        friend bool operator==(const uri_wrapper& lhs, const uri_wrapper& rhs)
+        friend bool operator==(const uri_wrapper& lhs, const uri_wrapper& rhs) noexcept
         {
             return lhs.compare(rhs) == 0;
         }
 
-        friend bool operator!=(const uri_wrapper& lhs, const uri_wrapper& rhs)
+        friend bool operator!=(const uri_wrapper& lhs, const uri_wrapper& rhs) noexcept
         {
             return lhs.compare(rhs) != 0;
         }
 
-        friend bool operator<(const uri_wrapper& lhs, const uri_wrapper& rhs)
+        friend bool operator<(const uri_wrapper& lhs, const uri_wrapper& rhs) noexcept
         {
             return lhs.compare(rhs) < 0;
         }
 
-        friend bool operator<=(const uri_wrapper& lhs, const uri_wrapper& rhs)
+        friend bool operator<=(const uri_wrapper& lhs, const uri_wrapper& rhs) noexcept
         {
             return lhs.compare(rhs) <= 0;
         }
 
-        friend bool operator>(const uri_wrapper& lhs, const uri_wrapper& rhs)
+        friend bool operator>(const uri_wrapper& lhs, const uri_wrapper& rhs) noexcept
         {
             return lhs.compare(rhs) > 0;
         }
 
-        friend bool operator>=(const uri_wrapper& lhs, const uri_wrapper& rhs)
+        friend bool operator>=(const uri_wrapper& lhs, const uri_wrapper& rhs) noexcept
         {
             return lhs.compare(rhs) >= 0;
         }
     private:
+        // Takes pre-parsed state; for callers that already know how the
+        // fragment classifies.
+        uri_wrapper(jsoncons::uri&& uri, std::string&& identifier, bool has_plain_name_fragment)
+            : uri_(std::move(uri)), identifier_(std::move(identifier)),
+              has_plain_name_fragment_(has_plain_name_fragment)
+        {
+        }
     };
 
 } // namespace jsonschema
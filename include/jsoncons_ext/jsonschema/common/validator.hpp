@@ -71,6 +71,47 @@ namespace jsonschema {
         }
     };
 
+    // For callers that only need to know whether (or how often) a subschema
+    // failed; discards the messages instead of collecting them.
+    struct counting_error_listener : public error_reporter
+    {
+    private:
+        walk_result do_error(const validation_message& /* e */) final
+        {
+            return walk_result::advance;
+        }
+    };
+
+    // Unwinds a subschema evaluation on its first error via the
+    // walk_result::abort channel; for callers that only need existence of
+    // an error and can skip the rest of the subtree.
+    struct first_error_listener : public error_reporter
+    {
+    private:
+        walk_result do_error(const validation_message& /* e */) final
+        {
+            return walk_result::abort;
+        }
+    };
+
+    // Counts every error but retains the details of only the first one;
+    // for callers that report a single summary error for a whole loop and
+    // don't need one record per failing element.
+    struct first_error_collecting_listener : public error_reporter
+    {
+        std::vector<validation_message> errors; // holds at most one element
+
+    private:
+        walk_result do_error(const validation_message& msg) final
+        {
+            if (errors.empty())
+            {
+                errors.push_back(msg);
+            }
+            return walk_result::advance;
+        }
+    };
+
     class range
     {
         std::size_t start_{0};
@@ -23,6 +23,17 @@
 namespace jsoncons {
 namespace jsonschema {
 
+    // Returns a pointer to the value for key if sch is an object that
+    // contains key, null otherwise, so keyword lookups state the
+    // find/object_range().end() comparison once.
+    template <typename Json>
+    const Json* find_or_null(const Json& sch, string_view key)
+    {
+        auto it = sch.find(key);
+        return it != sch.object_range().end() ? &(*it).value() : nullptr;
+    }
+
+
     template <typename Json>
     using resolve_uri_type = std::function<Json(const jsoncons::uri & /*id*/)>;
 
@@ -195,8 +206,7 @@ namespace jsonschema {
                                     const std::string& key, 
                                     const Json& value)
         {
-            auto new_u = uri.append(key);
-            uri_wrapper new_uri(new_u);
+            uri_wrapper new_uri = uri.append(key);
 
             if (new_uri.has_fragment() && !new_uri.has_plain_name_fragment()) 
             {
@@ -307,10 +317,10 @@ namespace jsonschema {
             {
                 case json_type::object_value:
                 {
-                    auto it = std::move(sch).find("$schema");
-                    if (it != std::move(sch).object_range().end())
+                    const Json* it = find_or_null(sch, "$schema");
+                    if (it != nullptr)
                     {
-                        if ((*it).value().as_string_view() == schema())
+                        if ((*it).as_string_view() == schema())
                         {
                             return make_schema_validator(context, std::move(sch), keys, anchor_dict);
                         }
@@ -411,8 +421,15 @@ namespace jsonschema {
             const Json& sch, const Json& parent)
         {
             uri schema_location = context.make_schema_location("required");
+            std::vector<std::string> items;
+            items.reserve(sch.size());
+            for (const auto& item : sch.array_range())
+            {
+                auto sv = item.as_string_view();
+                items.emplace_back(sv.data(), sv.size());
+            }
             return jsoncons::make_unique<required_validator<Json>>(parent, schema_location, 
-                context.get_custom_message("required"), sch.template as<std::vector<std::string>>());
+                context.get_custom_message("required"), std::move(items));
         }
 
         virtual std::unique_ptr<maximum_validator<Json>> make_maximum_validator(const compilation_context& context, 
@@ -529,6 +546,7 @@ namespace jsonschema {
 
                 case json_type::array_value: // "type": ["type1", "type2"]
                 {
+                    expected_types.reserve(sch.size());
                     for (const auto& item : sch.array_range())
                     {
                         auto type = item.template as<std::string>();
@@ -598,16 +616,16 @@ namespace jsonschema {
             }
             
             std::string content_encoding;
-            auto it = parent.find("contentEncoding");
-            if (it != parent.object_range().end())
+            const Json* it = find_or_null(parent, "contentEncoding");
+            if (it != nullptr)
             {
-                if (!(*it).value().is_string())
+                if (!(*it).is_string())
                 {
                     const std::string message("contentEncoding must be a string");
                     JSONCONS_THROW(schema_error(schema_location.string() + ": " + message));
                 }
 
-                content_encoding = (*it).value().as_string();
+                content_encoding = (*it).as_string();
             }
             
             auto value = sch.template as<std::string>();
@@ -622,68 +640,37 @@ namespace jsonschema {
 
             std::string format = sch.template as<std::string>();
 
+            struct format_entry
+            {
+                const char* name;
+                const char* message_key;
+                validate_format validate;
+            };
+            static const format_entry format_table[] = {
+                {"date-time", "format.date-time", rfc3339_date_time_check},
+                {"date", "format.date", rfc3339_date_check},
+                {"time", "format.time", rfc3339_time_check},
+                {"email", "format.email", email_check},
+                {"hostname", "format.hostname", hostname_check},
+                {"ipv4", "format.ipv4", ipv4_check},
+                {"ipv6", "format.ipv6", ipv6_check},
+                {"regex", "format.regex", regex_check},
+                {"json-pointer", "format.json-pointer", jsonpointer_check},
+                {"uri", "format.uri", uri_check},
+                {"uri-reference", "format.uri-reference", uri_reference_check}
+            };
+
             std::string message_key;
-            validate_format validate;
-            if (format == "date-time")
+            validate_format validate = nullptr; // Not supported - ignore
+            for (const auto& entry : format_table)
             {
-                message_key = "format.date-time";
-                validate = rfc3339_date_time_check;
+                if (format == entry.name)
+                {
+                    message_key = entry.message_key;
+                    validate = entry.validate;
+                    break;
+                }
             }
-            else if (format == "date") 
-            {
-                message_key = "format.date";
-                validate = rfc3339_date_check;
-            } 
-            else if (format == "time") 
-            {
-                message_key = "format.time";
-                validate = rfc3339_time_check;
-            } 
-            else if (format == "email") 
-            {
-                message_key = "format.email";
-                validate = email_check;
-            } 
-            else if (format == "hostname") 
-            {
-                message_key = "format.hostname";
-                validate = hostname_check;
-            } 
-            else if (format == "ipv4") 
-            {
-                message_key = "format.ipv4";
-                validate = ipv4_check;
-            } 
-            else if (format == "ipv6") 
-            {
-                message_key = "format.ipv6";
-                validate = ipv6_check;
-            } 
-            else if (format == "regex") 
-            {
-                message_key = "format.regex";
-                validate = regex_check;
-            } 
-            else if (format == "json-pointer") 
-            {
-                message_key = "format.json-pointer";
-                validate = jsonpointer_check;
-            } 
-            else if (format == "uri") 
-            {
-                message_key = "format.uri";
-                validate = uri_check;
-            } 
-            else if (format == "uri-reference") 
-            {
-                message_key = "format.uri-reference";
-                validate = uri_reference_check;
-            } 
-            else
-            {
-                // Not supported - ignore
-                validate = nullptr;
-            }       
 
             return jsoncons::make_unique<format_validator<Json>>(parent, schema_location, context.get_custom_message(message_key), 
                 validate);
@@ -694,9 +681,8 @@ namespace jsonschema {
         {
             uri schema_location = context.make_schema_location("pattern");
             auto pattern_string = sch.template as<std::string>();
-            auto regex = std::regex(pattern_string, std::regex::ECMAScript);
             return jsoncons::make_unique<pattern_validator<Json>>(parent, schema_location, context.get_custom_message("pattern"), 
-                pattern_string, regex);
+                pattern_string);
         }
 
         virtual std::unique_ptr<max_items_validator<Json>> make_max_items_validator(const compilation_context& context, 
@@ -765,11 +751,11 @@ namespace jsonschema {
             std::string sub_keys[] = { "contains" };
 
             std::unique_ptr<max_contains_keyword<Json>> max_contains;
-            auto it = parent.find("maxContains");
-            if (it != parent.object_range().end()) 
+            const Json* it = find_or_null(parent, "maxContains");
+            if (it != nullptr) 
             {
                 uri path = context.make_schema_location("maxContains");
-                auto value = (*it).value().template as<std::size_t>();
+                auto value = (*it).template as<std::size_t>();
                 max_contains = jsoncons::make_unique<max_contains_keyword<Json>>(parent, path, context.get_custom_message("maxContains"), value);
             }
             else
@@ -779,11 +765,11 @@ namespace jsonschema {
             }
 
             std::unique_ptr<min_contains_keyword<Json>> min_contains;
-            it = parent.find("minContains");
-            if (it != parent.object_range().end()) 
+            it = find_or_null(parent, "minContains");
+            if (it != nullptr) 
             {
                 uri path = context.make_schema_location("minContains");
-                auto value = (*it).value().template as<std::size_t>();
+                auto value = (*it).template as<std::size_t>();
                 min_contains = jsoncons::make_unique<min_contains_keyword<Json>>(parent, path, context.get_custom_message("minContains"), value);
             }
             else
@@ -811,6 +797,7 @@ namespace jsonschema {
         {
             uri schema_location = context.make_schema_location("allOf");
             std::vector<schema_validator_ptr_type> subschemas;
+            subschemas.reserve(sch.size());
 
             std::size_t c = 0;
             for (const auto& subsch : sch.array_range())
@@ -827,6 +814,7 @@ namespace jsonschema {
         {
             uri schema_location = context.make_schema_location("anyOf");
             std::vector<schema_validator_ptr_type> subschemas;
+            subschemas.reserve(sch.size());
 
             std::size_t c = 0;
             for (const auto& subsch : sch.array_range())
@@ -843,6 +831,7 @@ namespace jsonschema {
         {
             uri schema_location{ context.make_schema_location("oneOf") };
             std::vector<schema_validator_ptr_type> subschemas;
+            subschemas.reserve(sch.size());
 
             std::size_t c = 0;
             for (const auto& subsch : sch.array_range())
@@ -978,6 +967,7 @@ namespace jsonschema {
 
             if (sch.type() == json_type::array_value) 
             {
+                prefix_item_validators.reserve(sch.size());
                 std::size_t c = 0;
                 for (const auto& subsch : sch.array_range())
                 {
@@ -986,14 +976,14 @@ namespace jsonschema {
                     prefix_item_validators.emplace_back(this->make_cross_draft_schema_validator(context, subsch, sub_keys, anchor_dict));
                 }
 
-                auto it = parent.find("additionalItems");
-                if (it != parent.object_range().end()) 
+                const Json* it = find_or_null(parent, "additionalItems");
+                if (it != nullptr) 
                 {
                     uri items_location{context.make_schema_location("additionalItems")};
                     std::string sub_keys[] = {"additionalItems"};
                     items_val = jsoncons::make_unique<items_keyword<Json>>("additionalItems", parent, items_location, 
                         context.get_custom_message("additionalItems"),
-                        this->make_cross_draft_schema_validator(context, (*it).value(), sub_keys, anchor_dict));
+                        this->make_cross_draft_schema_validator(context, (*it), sub_keys, anchor_dict));
                 }
             }
 
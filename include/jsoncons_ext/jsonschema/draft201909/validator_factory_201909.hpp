@@ -32,7 +32,7 @@ namespace jsonschema {
 namespace draft201909 {
 
     template <typename Json>
-    class validator_factory_201909 : public validator_factory<Json> 
+    class validator_factory_201909 final : public validator_factory<Json> 
     {
     public:
         using schema_store_type = typename validator_factory<Json>::schema_store_type;
@@ -245,6 +245,8 @@ namespace draft201909 {
             jsoncons::optional<jsoncons::uri> id = context.id();
             Json default_value{ jsoncons::null_type()};
             std::vector<keyword_validator_ptr_type> validators;
+            // The member count bounds the keyword validators this object can produce.
+            validators.reserve(sch.size());
             std::unique_ptr<unevaluated_properties_validator<Json>> unevaluated_properties_val;
             std::unique_ptr<unevaluated_items_validator<Json>> unevaluated_items_val;
             std::set<std::string> known_keywords;
@@ -253,10 +255,10 @@ namespace draft201909 {
 
             if (this->options().compatibility_mode())
             {
-                auto it = sch.find("definitions");
-                if (it != sch.object_range().end()) 
+                const Json* it = find_or_null(sch, "definitions");
+                if (it != nullptr) 
                 {
-                    for (const auto& def : (*it).value().object_range())
+                    for (const auto& def : (*it).object_range())
                     {
                         std::string sub_keys[] = { "definitions", def.key() };
                         defs.emplace(def.key(), make_schema_validator(context, def.value(), sub_keys, anchor_dict));
@@ -264,10 +266,10 @@ namespace draft201909 {
                     known_keywords.insert("definitions");
                 }
             }
-            auto it = sch.find("$defs");
-            if (it != sch.object_range().end()) 
+            const Json* it = find_or_null(sch, "$defs");
+            if (it != nullptr) 
             {
-                for (const auto& def : (*it).value().object_range())
+                for (const auto& def : (*it).object_range())
                 {
                     std::string sub_keys[] = { "$defs", def.key() };
                     defs.emplace(def.key(), make_schema_validator(context, def.value(), sub_keys, anchor_dict));
@@ -275,32 +277,32 @@ namespace draft201909 {
                 known_keywords.insert("$defs");
             }
 
-            it = sch.find("$recursiveAnchor"); 
-            if (it != sch.object_range().end()) 
+            it = find_or_null(sch, "$recursiveAnchor"); 
+            if (it != nullptr) 
             {
-                recursive_anchor = (*it).value().template as<bool>();
+                recursive_anchor = (*it).template as<bool>();
             }
 
-            it = sch.find("default");
-            if (it != sch.object_range().end()) 
+            it = find_or_null(sch, "default");
+            if (it != nullptr) 
             {
-                default_value = (*it).value();
+                default_value = (*it);
                 known_keywords.insert("default");
             }
 
-            it = sch.find("$ref");
-            if (it != sch.object_range().end()) // this schema has a reference
+            it = find_or_null(sch, "$ref");
+            if (it != nullptr) // this schema has a reference
             {
-                uri relative{(*it).value().template as<std::string>()}; 
+                uri relative{(*it).template as<std::string>()}; 
                 auto resolved = context.get_base_uri().resolve(relative);
                 validators.push_back(this->get_or_create_reference(sch, uri_wrapper{resolved}));
             }
 
-            it = sch.find("$recursiveRef");
-            if (it != sch.object_range().end()) // this schema has a reference
+            it = find_or_null(sch, "$recursiveRef");
+            if (it != nullptr) // this schema has a reference
             {
                 std::string custom_message = context.get_custom_message("$recursiveRef");
-                uri relative((*it).value().template as<std::string>());
+                uri relative((*it).template as<std::string>());
                 auto ref = context.get_base_uri().resolve(relative);
                 auto orig = jsoncons::make_unique<recursive_ref_validator_type>(sch, ref.base(), custom_message); 
                 this->unresolved_refs_.emplace_back(ref, orig.get());
@@ -309,41 +311,41 @@ namespace draft201909 {
             
             if (include_applicator_)
             {               
-                it = sch.find("propertyNames");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "propertyNames");
+                if (it != nullptr) 
                 {
-                    validators.emplace_back(this->make_property_names_validator(context, (*it).value(), sch, anchor_dict));
+                    validators.emplace_back(this->make_property_names_validator(context, (*it), sch, anchor_dict));
                 }
 
-                it = sch.find("dependentSchemas");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "dependentSchemas");
+                if (it != nullptr) 
                 {
-                    validators.emplace_back(this->make_dependent_schemas_validator(context, (*it).value(), sch, anchor_dict));
+                    validators.emplace_back(this->make_dependent_schemas_validator(context, (*it), sch, anchor_dict));
                 }
                 
                 schema_validator_ptr_type if_validator;
                 schema_validator_ptr_type then_validator;
                 schema_validator_ptr_type else_validator;
     
-                it = sch.find("if");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "if");
+                if (it != nullptr) 
                 {
                     std::string sub_keys[] = { "if" };
-                    if_validator = make_schema_validator(context, (*it).value(), sub_keys, anchor_dict);
+                    if_validator = make_schema_validator(context, (*it), sub_keys, anchor_dict);
                 }
     
-                it = sch.find("then");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "then");
+                if (it != nullptr) 
                 {
                     std::string sub_keys[] = { "then" };
-                    then_validator = make_schema_validator(context, (*it).value(), sub_keys, anchor_dict);
+                    then_validator = make_schema_validator(context, (*it), sub_keys, anchor_dict);
                 }
     
-                it = sch.find("else");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "else");
+                if (it != nullptr) 
                 {
                     std::string sub_keys[] = { "else" };
-                    else_validator = make_schema_validator(context, (*it).value(), sub_keys, anchor_dict);
+                    else_validator = make_schema_validator(context, (*it), sub_keys, anchor_dict);
                 }
                 if (if_validator || then_validator || else_validator)
                 {
@@ -355,25 +357,25 @@ namespace draft201909 {
                 // Object validators
     
                 std::unique_ptr<properties_validator<Json>> properties;
-                it = sch.find("properties");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "properties");
+                if (it != nullptr) 
                 {
-                    properties = this->make_properties_validator(context, (*it).value(), sch, anchor_dict);
+                    properties = this->make_properties_validator(context, (*it), sch, anchor_dict);
                 }
                 std::unique_ptr<pattern_properties_validator<Json>> pattern_properties;
     
         #if defined(JSONCONS_HAS_STD_REGEX)
-                it = sch.find("patternProperties");
-                if (it != sch.object_range().end())
+                it = find_or_null(sch, "patternProperties");
+                if (it != nullptr)
                 {
-                    pattern_properties = make_pattern_properties_validator(context, (*it).value(), sch, anchor_dict);
+                    pattern_properties = make_pattern_properties_validator(context, (*it), sch, anchor_dict);
                 }
         #endif
     
-                it = sch.find("additionalProperties");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "additionalProperties");
+                if (it != nullptr) 
                 {
-                    validators.emplace_back(this->make_additional_properties_validator(context, (*it).value(), sch,
+                    validators.emplace_back(this->make_additional_properties_validator(context, (*it), sch,
                         std::move(properties), std::move(pattern_properties), anchor_dict));
                 }
                 else
@@ -390,18 +392,18 @@ namespace draft201909 {
     #endif
                 }
     
-                it = sch.find("items");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "items");
+                if (it != nullptr) 
                 {
     
-                    if ((*it).value().type() == json_type::array_value) 
+                    if ((*it).type() == json_type::array_value) 
                     {
-                        validators.emplace_back(this->make_prefix_items_validator_07(context, (*it).value(), sch, anchor_dict));
+                        validators.emplace_back(this->make_prefix_items_validator_07(context, (*it), sch, anchor_dict));
                     } 
-                    else if ((*it).value().type() == json_type::object_value ||
-                               (*it).value().type() == json_type::bool_value)
+                    else if ((*it).type() == json_type::object_value ||
+                               (*it).type() == json_type::bool_value)
                     {
-                        validators.emplace_back(this->make_items_validator("items", context, (*it).value(), sch, anchor_dict));
+                        validators.emplace_back(this->make_items_validator("items", context, (*it), sch, anchor_dict));
                     }
                 }
             }
@@ -425,24 +427,24 @@ namespace draft201909 {
             {
                 if (this->options().require_format_validation())
                 {
-                    it = sch.find("format");
-                    if (it != sch.object_range().end()) 
+                    it = find_or_null(sch, "format");
+                    if (it != nullptr) 
                     {
-                        validators.emplace_back(this->make_format_validator(context, (*it).value(), sch));
+                        validators.emplace_back(this->make_format_validator(context, (*it), sch));
                     }
                 }
             }
             if (include_unevaluated_)
             {
-                it = sch.find("unevaluatedProperties");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "unevaluatedProperties");
+                if (it != nullptr) 
                 {
-                    unevaluated_properties_val = this->make_unevaluated_properties_validator(context, (*it).value(), sch, anchor_dict);
+                    unevaluated_properties_val = this->make_unevaluated_properties_validator(context, (*it), sch, anchor_dict);
                 }
-                it = sch.find("unevaluatedItems");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "unevaluatedItems");
+                if (it != nullptr) 
                 {
-                    unevaluated_items_val = this->make_unevaluated_items_validator(context, (*it).value(), sch, anchor_dict);
+                    unevaluated_items_val = this->make_unevaluated_items_validator(context, (*it), sch, anchor_dict);
                 }
             }
             
@@ -460,13 +462,13 @@ namespace draft201909 {
             uri schema_location = context.get_base_uri();
             std::string custom_message = context.get_custom_message(keyword);
 
-            std::vector<std::pair<std::regex, schema_validator_ptr_type>> pattern_properties;
+            std::vector<std::pair<string_pattern, schema_validator_ptr_type>> pattern_properties;
             
             for (const auto& prop : sch.object_range())
             {
                 pattern_properties.emplace_back(
                     std::make_pair(
-                        std::regex(prop.key(), std::regex::ECMAScript),
+                        string_pattern(prop.key()),
                         make_schema_validator(context, prop.value(), {}, anchor_dict)));
             }
 
@@ -483,6 +485,7 @@ namespace draft201909 {
         {
             // Exclude uri's that are not plain name identifiers
             std::vector<uri_wrapper> new_uris;
+            new_uris.reserve(parent.uris().size());
             for (const auto& uri : parent.uris())
             {
                 if (!uri.has_plain_name_fragment())
@@ -496,8 +499,7 @@ namespace draft201909 {
             {
                 for (auto& uri : new_uris)
                 {
-                    auto new_u = uri.append(key);
-                    uri = uri_wrapper(new_u);
+                    uri = uri.append(key);
                 }
             }
 
@@ -506,10 +508,10 @@ namespace draft201909 {
             std::string custom_message;
             if (sch.is_object())
             {
-                auto it = sch.find("$id"); // If $id is found, this schema can be referenced by the id
-                if (it != sch.object_range().end()) 
+                const Json* it = find_or_null(sch, "$id"); // If $id is found, this schema can be referenced by the id
+                if (it != nullptr) 
                 {
-                    uri relative((*it).value().template as<std::string>()); 
+                    uri relative((*it).template as<std::string>()); 
                     if (relative.has_fragment())
                     {
                         JSONCONS_THROW(schema_error("Draft 2019-09 does not allow $id with fragment"));
@@ -524,10 +526,10 @@ namespace draft201909 {
                         new_uris.emplace_back(new_uri); 
                     }
                 }
-                it = sch.find("$anchor"); 
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "$anchor"); 
+                if (it != nullptr) 
                 {
-                    auto anchor = (*it).value().template as<std::string>();
+                    auto anchor = (*it).template as<std::string>();
                     if (!this->validate_anchor(anchor))
                     {
                         JSONCONS_THROW(schema_error("Invalid $anchor " + anchor));
@@ -543,10 +545,10 @@ namespace draft201909 {
 
                 if (this->options().enable_custom_error_message())
                 {
-                    it = sch.find("errorMessage"); 
-                    if (it != sch.object_range().end()) 
+                    it = find_or_null(sch, "errorMessage"); 
+                    if (it != nullptr) 
                     {
-                        const auto& value = it->value();
+                        const auto& value = (*it);
                         if (value.is_object())
                         {
                             for (const auto& item : value.object_range())
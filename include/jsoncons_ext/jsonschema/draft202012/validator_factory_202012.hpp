@@ -32,7 +32,7 @@ namespace jsonschema {
 namespace draft202012 {
 
     template <typename Json>
-    class validator_factory_202012 : public validator_factory<Json> 
+    class validator_factory_202012 final : public validator_factory<Json> 
     {
     public:
         using schema_store_type = typename validator_factory<Json>::schema_store_type;
@@ -245,16 +245,18 @@ namespace draft202012 {
             jsoncons::optional<jsoncons::uri> id = context.id();
             Json default_value{jsoncons::null_type()};
             std::vector<keyword_validator_ptr_type> validators;
+            // The member count bounds the keyword validators this object can produce.
+            validators.reserve(sch.size());
             std::unique_ptr<unevaluated_properties_validator<Json>> unevaluated_properties_val;
             std::unique_ptr<unevaluated_items_validator<Json>> unevaluated_items_val;
             jsoncons::optional<jsoncons::uri> dynamic_anchor;
             std::map<std::string,schema_validator_ptr_type> defs;
             anchor_uri_map_type local_anchor_dict;
 
-            auto it = sch.find("$dynamicAnchor"); 
-            if (it != sch.object_range().end()) 
+            const Json* it = find_or_null(sch, "$dynamicAnchor"); 
+            if (it != nullptr) 
             {
-                std::string value = (*it).value().template as<std::string>();
+                std::string value = (*it).template as<std::string>();
                 jsoncons::uri new_uri(context.get_base_uri(), uri_fragment_part, value);
                 dynamic_anchor = jsoncons::optional<jsoncons::uri>(new_uri);
                 local_anchor_dict.emplace(value, context.get_base_uri());
@@ -262,44 +264,44 @@ namespace draft202012 {
 
             if (this->options().compatibility_mode())
             {
-                it = sch.find("definitions");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "definitions");
+                if (it != nullptr) 
                 {
-                    for (const auto& def : (*it).value().object_range())
+                    for (const auto& def : (*it).object_range())
                     {
                         std::string sub_keys[] = { "definitions", def.key() };
                         defs.emplace(def.key(), this->make_cross_draft_schema_validator(context, def.value(), sub_keys, local_anchor_dict));
                     }
                 }
             }
-            it = sch.find("$defs");
-            if (it != sch.object_range().end()) 
+            it = find_or_null(sch, "$defs");
+            if (it != nullptr) 
             {
-                for (const auto& def : (*it).value().object_range())
+                for (const auto& def : (*it).object_range())
                 {
                     std::string sub_keys[] = { "$defs", def.key() };
                     defs.emplace(def.key(), this->make_cross_draft_schema_validator(context, def.value(), sub_keys, local_anchor_dict));
                 }
             }
 
-            it = sch.find("default");
-            if (it != sch.object_range().end()) 
+            it = find_or_null(sch, "default");
+            if (it != nullptr) 
             {
-                default_value = (*it).value();
+                default_value = (*it);
             }
 
-            it = sch.find("$ref");
-            if (it != sch.object_range().end()) // this schema has a reference
+            it = find_or_null(sch, "$ref");
+            if (it != nullptr) // this schema has a reference
             {
-                uri relative((*it).value().template as<std::string>()); 
+                uri relative((*it).template as<std::string>()); 
                 auto ref = context.get_base_uri().resolve(relative)                   ;
                 validators.push_back(this->get_or_create_reference(sch, uri_wrapper(ref)));
             }
 
-            it = sch.find("$dynamicRef");
-            if (it != sch.object_range().end()) // this schema has a reference
+            it = find_or_null(sch, "$dynamicRef");
+            if (it != nullptr) // this schema has a reference
             {
-                std::string value = (*it).value().template as<std::string>();
+                std::string value = (*it).template as<std::string>();
                 uri relative(value); 
                 auto ref = context.get_base_uri().resolve(relative)                   ;
                 auto orig = jsoncons::make_unique<dynamic_ref_validator_type>(sch, ref.base(), 
@@ -310,41 +312,41 @@ namespace draft202012 {
 
             if (include_applicator_)
             {
-                it = sch.find("propertyNames");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "propertyNames");
+                if (it != nullptr) 
                 {
-                    validators.emplace_back(this->make_property_names_validator(context, (*it).value(), sch, local_anchor_dict));
+                    validators.emplace_back(this->make_property_names_validator(context, (*it), sch, local_anchor_dict));
                 }
 
-                it = sch.find("dependentSchemas");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "dependentSchemas");
+                if (it != nullptr) 
                 {
-                    validators.emplace_back(this->make_dependent_schemas_validator(context, (*it).value(), sch, local_anchor_dict));
+                    validators.emplace_back(this->make_dependent_schemas_validator(context, (*it), sch, local_anchor_dict));
                 }
 
                 schema_validator_ptr_type if_validator;
                 schema_validator_ptr_type then_validator;
                 schema_validator_ptr_type else_validator;
 
-                it = sch.find("if");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "if");
+                if (it != nullptr) 
                 {
                     std::string sub_keys[] = { "if" };
-                    if_validator = this->make_cross_draft_schema_validator(context, (*it).value(), sub_keys, local_anchor_dict);
+                    if_validator = this->make_cross_draft_schema_validator(context, (*it), sub_keys, local_anchor_dict);
                 }
 
-                it = sch.find("then");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "then");
+                if (it != nullptr) 
                 {
                     std::string sub_keys[] = { "then" };
-                    then_validator = this->make_cross_draft_schema_validator(context, (*it).value(), sub_keys, local_anchor_dict);
+                    then_validator = this->make_cross_draft_schema_validator(context, (*it), sub_keys, local_anchor_dict);
                 }
 
-                it = sch.find("else");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "else");
+                if (it != nullptr) 
                 {
                     std::string sub_keys[] = { "else" };
-                    else_validator = this->make_cross_draft_schema_validator(context, (*it).value(), sub_keys, local_anchor_dict);
+                    else_validator = this->make_cross_draft_schema_validator(context, (*it), sub_keys, local_anchor_dict);
                 }
                 if (if_validator || then_validator || else_validator)
                 {
@@ -355,25 +357,25 @@ namespace draft202012 {
                 // Object validators
 
                 std::unique_ptr<properties_validator<Json>> properties;
-                it = sch.find("properties");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "properties");
+                if (it != nullptr) 
                 {
-                    properties = this->make_properties_validator(context, (*it).value(), sch, local_anchor_dict);
+                    properties = this->make_properties_validator(context, (*it), sch, local_anchor_dict);
                 }
                 std::unique_ptr<pattern_properties_validator<Json>> pattern_properties;
 
         #if defined(JSONCONS_HAS_STD_REGEX)
-                it = sch.find("patternProperties");
-                if (it != sch.object_range().end())
+                it = find_or_null(sch, "patternProperties");
+                if (it != nullptr)
                 {
-                    pattern_properties = make_pattern_properties_validator(context, (*it).value(), sch, local_anchor_dict);
+                    pattern_properties = make_pattern_properties_validator(context, (*it), sch, local_anchor_dict);
                 }
         #endif
 
-                it = sch.find("additionalProperties");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "additionalProperties");
+                if (it != nullptr) 
                 {
-                    validators.emplace_back(this->make_additional_properties_validator(context, (*it).value(), sch, 
+                    validators.emplace_back(this->make_additional_properties_validator(context, (*it), sch, 
                         std::move(properties), std::move(pattern_properties), local_anchor_dict));
                 }
                 else
@@ -390,23 +392,23 @@ namespace draft202012 {
     #endif
                 }
 
-                it = sch.find("prefixItems");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "prefixItems");
+                if (it != nullptr) 
                 {
 
-                    if ((*it).value().type() == json_type::array_value) 
+                    if ((*it).type() == json_type::array_value) 
                     {
-                        validators.emplace_back(make_prefix_items_validator(context, (*it).value(), sch, local_anchor_dict));
+                        validators.emplace_back(make_prefix_items_validator(context, (*it), sch, local_anchor_dict));
                     } 
                 }
                 else
                 {
-                    it = sch.find("items");
-                    if (it != sch.object_range().end()) 
+                    it = find_or_null(sch, "items");
+                    if (it != nullptr) 
                     {
-                        if ((*it).value().type() == json_type::object_value || (*it).value().type() == json_type::bool_value)
+                        if ((*it).type() == json_type::object_value || (*it).type() == json_type::bool_value)
                         {
-                            validators.emplace_back(this->make_items_validator("items", context, (*it).value(), sch, local_anchor_dict));
+                            validators.emplace_back(this->make_items_validator("items", context, (*it), sch, local_anchor_dict));
                         }
                     }
                 }
@@ -432,25 +434,25 @@ namespace draft202012 {
             {
                 if (this->options().require_format_validation())
                 {
-                    it = sch.find("format");
-                    if (it != sch.object_range().end()) 
+                    it = find_or_null(sch, "format");
+                    if (it != nullptr) 
                     {
-                        validators.emplace_back(this->make_format_validator(context, (*it).value(), sch));
+                        validators.emplace_back(this->make_format_validator(context, (*it), sch));
                     }
                 }
             }
             
             if (include_unevaluated_)
             {
-                it = sch.find("unevaluatedProperties");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "unevaluatedProperties");
+                if (it != nullptr) 
                 {
-                    unevaluated_properties_val = this->make_unevaluated_properties_validator(context, (*it).value(), sch, local_anchor_dict);
+                    unevaluated_properties_val = this->make_unevaluated_properties_validator(context, (*it), sch, local_anchor_dict);
                 }
-                it = sch.find("unevaluatedItems");
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "unevaluatedItems");
+                if (it != nullptr) 
                 {
-                    unevaluated_items_val = this->make_unevaluated_items_validator(context, (*it).value(), sch, local_anchor_dict);
+                    unevaluated_items_val = this->make_unevaluated_items_validator(context, (*it), sch, local_anchor_dict);
                 }
             }
 
@@ -483,6 +485,7 @@ namespace draft202012 {
 
             if (sch.type() == json_type::array_value) 
             {
+                prefix_item_validators.reserve(sch.size());
                 std::size_t c = 0;
                 for (const auto& subsch : sch.array_range())
                 {
@@ -491,15 +494,15 @@ namespace draft202012 {
                     prefix_item_validators.emplace_back(this->make_cross_draft_schema_validator(context, subsch, sub_keys, anchor_dict));
                 }
 
-                auto it = parent.find("items");
-                if (it != parent.object_range().end()) 
+                const Json* it = find_or_null(parent, "items");
+                if (it != nullptr) 
                 {
                     uri items_location{context.make_schema_location("items")};
                     std::string sub_keys[] = { "additionalItems" };
 
                     items_val = jsoncons::make_unique<items_keyword<Json>>("items", parent, items_location,
                         context.get_custom_message("items"),
-                        this->make_cross_draft_schema_validator(context, (*it).value(), sub_keys, anchor_dict));
+                        this->make_cross_draft_schema_validator(context, (*it), sub_keys, anchor_dict));
                 }
             }
 
@@ -517,13 +520,13 @@ namespace draft202012 {
             uri schema_location = context.get_base_uri();
             std::string custom_message = context.get_custom_message(keyword);
 
-            std::vector<std::pair<std::regex, schema_validator_ptr_type>> pattern_properties;
+            std::vector<std::pair<string_pattern, schema_validator_ptr_type>> pattern_properties;
             
             for (const auto& prop : sch.object_range())
             {
                 pattern_properties.emplace_back(
                     std::make_pair(
-                        std::regex(prop.key(), std::regex::ECMAScript),
+                        string_pattern(prop.key()),
                         this->make_cross_draft_schema_validator(context, prop.value(), {}, anchor_dict)));
             }
 
@@ -540,6 +543,7 @@ namespace draft202012 {
         {
             // Exclude uri's that are not plain name identifiers
             std::vector<uri_wrapper> new_uris;
+            new_uris.reserve(parent.uris().size());
             for (const auto& uri : parent.uris())
             {
                 if (!uri.has_plain_name_fragment())
@@ -553,8 +557,7 @@ namespace draft202012 {
             {
                 for (auto& uri : new_uris)
                 {
-                    auto new_u = uri.append(key);
-                    uri = uri_wrapper(new_u);
+                    uri = uri.append(key);
                 }
             }
 
@@ -563,10 +566,10 @@ namespace draft202012 {
             std::string custom_message;
             if (sch.is_object())
             {
-                auto it = sch.find("$id"); // If $id is found, this schema can be referenced by the id
-                if (it != sch.object_range().end()) 
+                const Json* it = find_or_null(sch, "$id"); // If $id is found, this schema can be referenced by the id
+                if (it != nullptr) 
                 {
-                    std::string str = (*it).value().template as<std::string>();
+                    std::string str = (*it).template as<std::string>();
                     uri relative(str); 
                     if (relative.has_fragment())
                     {
@@ -582,10 +585,10 @@ namespace draft202012 {
                         new_uris.emplace_back(new_uri); 
                     }
                 }
-                it = sch.find("$anchor"); 
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "$anchor"); 
+                if (it != nullptr) 
                 {
-                    auto anchor = (*it).value().template as<std::string>();
+                    auto anchor = (*it).template as<std::string>();
                     if (!this->validate_anchor(anchor))
                     {
                         JSONCONS_THROW(schema_error("Invalid $anchor " + anchor));
@@ -598,10 +601,10 @@ namespace draft202012 {
                         new_uris.emplace_back(std::move(identifier)); 
                     }                  
                 }
-                it = sch.find("$dynamicAnchor"); 
-                if (it != sch.object_range().end()) 
+                it = find_or_null(sch, "$dynamicAnchor"); 
+                if (it != nullptr) 
                 {
-                    auto anchor = (*it).value().template as<std::string>();
+                    auto anchor = (*it).template as<std::string>();
                     if (!this->validate_anchor(anchor))
                     {
                         JSONCONS_THROW(schema_error("Invalid $dynamicAnchor " + anchor));
@@ -617,10 +620,10 @@ namespace draft202012 {
 
                 if (this->options().enable_custom_error_message())
                 {
-                    it = sch.find("errorMessage"); 
-                    if (it != sch.object_range().end()) 
+                    it = find_or_null(sch, "errorMessage"); 
+                    if (it != nullptr) 
                     {
-                        const auto& value = it->value();
+                        const auto& value = (*it);
                         if (value.is_object())
                         {
                             for (const auto& item : value.object_range())
@@ -32,7 +32,7 @@ namespace jsonschema {
 namespace draft4 {
 
     template <typename Json>
-    class validator_factory_4 : public validator_factory<Json> 
+    class validator_factory_4 final : public validator_factory<Json> 
     {
     public:
         using schema_store_type = typename validator_factory<Json>::schema_store_type;
@@ -137,16 +137,16 @@ namespace draft4 {
                 }
                 case json_type::object_value:
                 {
-                    auto it = sch.find("$ref");
-                    if (it != sch.object_range().end()) // this schema is a reference
+                    const Json* it = find_or_null(sch, "$ref");
+                    if (it != nullptr) // this schema is a reference
                     {
                         std::vector<keyword_validator_ptr_type> validators;
                         std::map<std::string,schema_validator_ptr_type> defs;
 
-                        auto it2 = sch.find("definitions");
-                        if (it2 != sch.object_range().end()) 
+                        const Json* it2 = find_or_null(sch, "definitions");
+                        if (it2 != nullptr) 
                         {
-                            for (const auto& def : it2->value().object_range())
+                            for (const auto& def : (*it2).object_range())
                             {
                                 std::string sub_keys[] = { "definitions", def.key() };
                                 defs.emplace(def.key(), make_schema_validator(context, def.value(), sub_keys, anchor_dict));
@@ -154,7 +154,7 @@ namespace draft4 {
                         }
 
                         Json default_value{ jsoncons::null_type() };
-                        uri relative((*it).value().template as<std::string>()); 
+                        uri relative((*it).template as<std::string>()); 
                         auto id = context.get_base_uri().resolve(relative);
                         validators.push_back(this->get_or_create_reference(sch, uri_wrapper{id}));
                         schema_validator_ptr = jsoncons::make_unique<object_schema_validator<Json>>(
@@ -193,22 +193,24 @@ namespace draft4 {
             jsoncons::optional<jsoncons::uri> id = context.id();
             Json default_value{ jsoncons::null_type() };
             std::vector<keyword_validator_ptr_type> validators;
+            // The member count bounds the keyword validators this object can produce.
+            validators.reserve(sch.size());
             std::map<std::string,schema_validator_ptr_type> defs;
 
-            auto it = sch.find("definitions");
-            if (it != sch.object_range().end()) 
+            const Json* it = find_or_null(sch, "definitions");
+            if (it != nullptr) 
             {
-                for (const auto& def : (*it).value().object_range())
+                for (const auto& def : (*it).object_range())
                 {
                     std::string sub_keys[] = { "definitions", def.key() };
                     defs.emplace(def.key(), make_schema_validator(context, def.value(), sub_keys, anchor_dict));
                 }
             }
 
-            it = sch.find("default");
-            if (it != sch.object_range().end()) 
+            it = find_or_null(sch, "default");
+            if (it != nullptr) 
             {
-                default_value = (*it).value();
+                default_value = (*it);
             }
 
             for (const auto& key_value : sch.object_range())
@@ -225,25 +227,25 @@ namespace draft4 {
             }
             
             std::unique_ptr<properties_validator<Json>> properties;
-            it = sch.find("properties");
-            if (it != sch.object_range().end()) 
+            it = find_or_null(sch, "properties");
+            if (it != nullptr) 
             {
-                properties = this->make_properties_validator(context, (*it).value(), sch, anchor_dict);
+                properties = this->make_properties_validator(context, (*it), sch, anchor_dict);
             }
             std::unique_ptr<pattern_properties_validator<Json>> pattern_properties;
 
     #if defined(JSONCONS_HAS_STD_REGEX)
-            it = sch.find("patternProperties");
-            if (it != sch.object_range().end())
+            it = find_or_null(sch, "patternProperties");
+            if (it != nullptr)
             {
-                pattern_properties = make_pattern_properties_validator(context, (*it).value(), sch, anchor_dict);
+                pattern_properties = make_pattern_properties_validator(context, (*it), sch, anchor_dict);
             }
     #endif
 
-            it = sch.find("additionalProperties");
-            if (it != sch.object_range().end()) 
+            it = find_or_null(sch, "additionalProperties");
+            if (it != nullptr) 
             {
-                validators.emplace_back(this->make_additional_properties_validator(context, (*it).value(), sch,
+                validators.emplace_back(this->make_additional_properties_validator(context, (*it), sch,
                     std::move(properties), std::move(pattern_properties), anchor_dict));
             }
             else
@@ -260,18 +262,18 @@ namespace draft4 {
 #endif
             }
 
-            it = sch.find("items");
-            if (it != sch.object_range().end()) 
+            it = find_or_null(sch, "items");
+            if (it != nullptr) 
             {
 
-                if ((*it).value().type() == json_type::array_value) 
+                if ((*it).type() == json_type::array_value) 
                 {
-                    validators.emplace_back(this->make_prefix_items_validator_07(context, (*it).value(), sch, anchor_dict));
+                    validators.emplace_back(this->make_prefix_items_validator_07(context, (*it), sch, anchor_dict));
                 } 
-                else if ((*it).value().type() == json_type::object_value ||
-                           (*it).value().type() == json_type::bool_value)
+                else if ((*it).type() == json_type::object_value ||
+                           (*it).type() == json_type::bool_value)
                 {
-                    validators.emplace_back(this->make_items_validator("items", context, (*it).value(), sch, anchor_dict));
+                    validators.emplace_back(this->make_items_validator("items", context, (*it), sch, anchor_dict));
                 }
             }
             return jsoncons::make_unique<object_schema_validator<Json>>(context.get_base_uri(), 
@@ -287,13 +289,13 @@ namespace draft4 {
             uri schema_location = context.get_base_uri();
             std::string custom_message = context.get_custom_message(keyword);
 
-            std::vector<std::pair<std::regex, schema_validator_ptr_type>> pattern_properties;
+            std::vector<std::pair<string_pattern, schema_validator_ptr_type>> pattern_properties;
             
             for (const auto& prop : sch.object_range())
             {
                 pattern_properties.emplace_back(
                     std::make_pair(
-                        std::regex(prop.key(), std::regex::ECMAScript),
+                        string_pattern(prop.key()),
                         make_schema_validator(context, prop.value(), {}, anchor_dict)));
             }
 
@@ -317,10 +319,10 @@ namespace draft4 {
 
             if (parent.is_object())
             {
-                auto it = parent.find("exclusiveMaximum");
-                if (it != parent.object_range().end())
+                const Json* it = find_or_null(parent, "exclusiveMaximum");
+                if (it != nullptr)
                 {
-                    is_exclusive = (*it).value().as_bool();
+                    is_exclusive = (*it).as_bool();
                 }
             }
             if (is_exclusive)
@@ -349,10 +351,10 @@ namespace draft4 {
             bool is_exclusive = false;
             if (parent.is_object())
             {
-                auto it = parent.find("exclusiveMinimum");
-                if (it != parent.object_range().end())
+                const Json* it = find_or_null(parent, "exclusiveMinimum");
+                if (it != nullptr)
                 {
-                    is_exclusive = (*it).value().as_bool();
+                    is_exclusive = (*it).as_bool();
                 }
             }
             if (is_exclusive)
@@ -374,6 +376,7 @@ namespace draft4 {
         {
             // Exclude uri's that are not plain name identifiers
             std::vector<uri_wrapper> new_uris;
+            new_uris.reserve(parent.uris().size());
             for (const auto& uri : parent.uris())
             {
                 if (!uri.has_plain_name_fragment())
@@ -387,8 +390,7 @@ namespace draft4 {
             {
                 for (auto& uri : new_uris)
                 {
-                    auto new_u = uri.append(key);
-                    uri = uri_wrapper(new_u);
+                    uri = uri.append(key);
                 }
             }
             jsoncons::optional<uri> id;
@@ -396,10 +398,10 @@ namespace draft4 {
             std::string custom_message;
             if (sch.is_object())
             {
-                auto it = sch.find("id"); // If id is found, this schema can be referenced by the id
-                if (it != sch.object_range().end()) 
+                const Json* it = find_or_null(sch, "id"); // If id is found, this schema can be referenced by the id
+                if (it != nullptr) 
                 {
-                    uri relative((*it).value().template as<std::string>()); 
+                    uri relative((*it).template as<std::string>()); 
                     auto resolved = parent.get_base_uri().resolve(relative);
                     id = resolved;
                     uri_wrapper new_uri{ resolved };
@@ -413,10 +415,10 @@ namespace draft4 {
 
                 if (this->options().enable_custom_error_message())
                 {
-                    it = sch.find("errorMessage"); 
-                    if (it != sch.object_range().end()) 
+                    it = find_or_null(sch, "errorMessage"); 
+                    if (it != nullptr) 
                     {
-                        const auto& value = it->value();
+                        const auto& value = (*it);
                         if (value.is_object())
                         {
                             for (const auto& item : value.object_range())
@@ -330,14 +330,14 @@ private:
             return;
         }   
 
-        uint8_t b;
-        if (source_.read(&b, 1) == 0)
+        auto b = source_.get();
+        if (b.eof)
         {
             ec = ubjson_errc::unexpected_eof;
             more_ = false;
             return;
         }
-        read_value(visitor, b, ec);
+        read_value(visitor, b.value, ec);
     }
 
     void read_value(json_visitor& visitor, uint8_t type, std::error_code& ec)
@@ -378,14 +378,14 @@ private:
             }
             case jsoncons::ubjson::ubjson_type::uint8_type: 
             {
-                uint8_t b;
-                if (source_.read(&b, 1) == 0)
+                auto b = source_.get();
+                if (b.eof)
                 {
                     ec = ubjson_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
-                more_ = visitor.uint64_value(b, semantic_tag::none, *this, ec);
+                more_ = visitor.uint64_value(b.value, semantic_tag::none, *this, ec);
                 break;
             }
             case jsoncons::ubjson::ubjson_type::int16_type: 
@@ -561,8 +561,8 @@ private:
         if (c.value == jsoncons::ubjson::ubjson_type::type_marker)
         {
             source_.ignore(1);
-            uint8_t b;
-            if (source_.read(&b, 1) == 0)
+            auto b = source_.get();
+            if (b.eof)
             {
                 ec = ubjson_errc::unexpected_eof;
                 more_ = false;
@@ -589,7 +589,7 @@ private:
                     more_ = false;
                     return;
                 }
-                state_stack_.emplace_back(parse_mode::strongly_typed_array,length,b);
+                state_stack_.emplace_back(parse_mode::strongly_typed_array,length,b.value);
                 more_ = visitor.begin_array(length, semantic_tag::none, *this, ec);
             }
             else
@@ -650,8 +650,8 @@ private:
         if (c.value == jsoncons::ubjson::ubjson_type::type_marker)
         {
             source_.ignore(1);
-            uint8_t b;
-            if (source_.read(&b, 1) == 0)
+            auto b = source_.get();
+            if (b.eof)
             {
                 ec = ubjson_errc::unexpected_eof;
                 more_ = false;
@@ -678,7 +678,7 @@ private:
                     more_ = false;
                     return;
                 }
-                state_stack_.emplace_back(parse_mode::strongly_typed_map_key,length,b);
+                state_stack_.emplace_back(parse_mode::strongly_typed_map_key,length,b.value);
                 more_ = visitor.begin_object(length, semantic_tag::none, *this, ec);
             }
             else
@@ -765,14 +765,14 @@ private:
             }
             case jsoncons::ubjson::ubjson_type::uint8_type: 
             {
-                uint8_t b;
-                if (source_.read(&b, 1) == 0)
+                auto b = source_.get();
+                if (b.eof)
                 {
                     ec = ubjson_errc::unexpected_eof;
                     more_ = false;
                     return length;
                 }
-                length = b;
+                length = b.value;
                 break;
             }
             case jsoncons::ubjson::ubjson_type::int16_type: 
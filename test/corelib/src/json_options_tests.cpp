@@ -189,10 +189,10 @@ TEST_CASE("object_array empty array")
 }
     )";
 
+    json j = json::parse(s);
+
     SECTION("same_line")
     {
-        json j = json::parse(s);
-
         auto options = json_options{}
             .object_array_line_splits(line_split_kind::same_line);
 
@@ -207,8 +207,6 @@ TEST_CASE("object_array empty array")
 
     SECTION("new_line")
     {
-        json j = json::parse(s);
-
         auto options = json_options{}
             .object_array_line_splits(line_split_kind::new_line);
 
@@ -223,8 +221,6 @@ TEST_CASE("object_array empty array")
 
     SECTION("multi_line")
     {
-        json j = json::parse(s);
-
         auto options = json_options{}
             .object_array_line_splits(line_split_kind::multi_line);
 
@@ -248,6 +244,8 @@ TEST_CASE("object_array with/without line_length_limit")
 }
     )";
 
+    json j = json::parse(s);
+
     SECTION("same_line")
     {
     std::string expected = R"({
@@ -257,8 +255,6 @@ TEST_CASE("object_array with/without line_length_limit")
     "qux": [1,2,3,null,123,45.3,342334,234]
 })";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .line_length_limit(120)
             .spaces_around_comma(spaces_option::no_spaces)
@@ -283,8 +279,6 @@ TEST_CASE("object_array with/without line_length_limit")
     ]
 })";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .line_length_limit(120)
             .spaces_around_comma(spaces_option::no_spaces)
@@ -318,8 +312,6 @@ TEST_CASE("object_array with/without line_length_limit")
     ]
 })";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .spaces_around_comma(spaces_option::no_spaces)
             .array_array_line_splits(line_split_kind::same_line);
@@ -343,8 +335,6 @@ TEST_CASE("object_array with/without line_length_limit")
     ]
 })";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .line_length_limit(20)
             .spaces_around_comma(spaces_option::no_spaces)
@@ -371,8 +361,6 @@ TEST_CASE("object_array with/without line_length_limit")
     ]
 })";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .line_length_limit(20)
             .spaces_around_comma(spaces_option::no_spaces)
@@ -433,13 +421,14 @@ TEST_CASE("array_object with/without line_length_limit")
    }
 ]
     )";
+
+    json j = json::parse(s);
+
     SECTION("same_line")
     {
     std::string expected = R"([{"author": "Graham Greene","title": "The Comedians"},{"author": "Koji Suzuki","title": "ring"},{"author": "Haruki Murakami",
                                                                                                  "title": "A Wild Sheep Chase"}])";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .line_length_limit(120)
             .spaces_around_comma(spaces_option::no_spaces)
@@ -460,8 +449,6 @@ TEST_CASE("array_object with/without line_length_limit")
     {"author": "Haruki Murakami","title": "A Wild Sheep Chase"}
 ])";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .line_length_limit(120)
             .spaces_around_comma(spaces_option::no_spaces)
@@ -491,8 +478,6 @@ TEST_CASE("array_object with/without line_length_limit")
     }
 ])";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .spaces_around_comma(spaces_option::no_spaces);
 
@@ -511,8 +496,6 @@ TEST_CASE("array_object with/without line_length_limit")
     {"author": "Haruki Murakami",
      "title": "A Wild Sheep Chase"}])";
 
-        json j = json::parse(s);
-
         auto options = json_options{}
             .line_length_limit(20)
             .spaces_around_comma(spaces_option::no_spaces)
@@ -534,8 +517,6 @@ TEST_CASE("array_object with/without line_length_limit")
     {"author": "Haruki Murakami",
      "title": "A Wild Sheep Chase"}
 ])";
-        json j = json::parse(s);
-
         auto options = json_options{}
             .line_length_limit(20)
             .spaces_around_comma(spaces_option::no_spaces)
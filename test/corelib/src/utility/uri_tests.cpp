@@ -335,6 +335,28 @@ TEST_CASE("uri part decode tests")
         std::string decoded = jsoncons::uri::decode_part(raw);
         CHECK(decoded == expected);
     }
+    SECTION("no escapes")
+    {
+        std::string raw = "folder/folderInteger.json";
+
+        std::string decoded = jsoncons::uri::decode_part(raw);
+        CHECK(decoded == raw);
+    }
+    SECTION("escape after plain prefix")
+    {
+        std::string raw = "some/longer/path%20with space";
+        std::string expected = "some/longer/path with space";
+
+        std::string decoded = jsoncons::uri::decode_part(raw);
+        CHECK(decoded == expected);
+    }
+    SECTION("invalid escape")
+    {
+        std::string raw = "a%zzb%2";
+
+        std::string decoded = jsoncons::uri::decode_part(raw);
+        CHECK(decoded == raw);
+    }
 }
 
 TEST_CASE("uri part encode tests")
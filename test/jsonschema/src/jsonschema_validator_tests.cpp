@@ -62,6 +62,37 @@ TEST_CASE("jsonschema validator tests")
     }
 }
 
+TEST_CASE("jsonschema numeric-equal bigint tests")
+{
+    // Out-of-range integers are stored as number-tagged strings and
+    // compare numerically, so the enum and uniqueItems hash screens
+    // must treat them like the doubles they equal.
+    SECTION("enum")
+    {
+        json schema = json::parse(R"({"enum": [1e20]})");
+        jsonschema::json_schema<json> compiled = jsonschema::make_json_schema(schema);
+
+        json instance = json::parse("100000000000000000000");
+        CHECK(instance == schema["enum"][0]);
+        CHECK(compiled.is_valid(instance));
+    }
+
+    SECTION("uniqueItems with more than 8 items")
+    {
+        json schema = json::parse(R"({"uniqueItems": true})");
+        jsonschema::json_schema<json> compiled = jsonschema::make_json_schema(schema);
+
+        json instance = json::parse(
+            R"([1.5,2.5,3.5,4.5,5.5,6.5,7.5,8.5,1e20,100000000000000000000])");
+        CHECK(instance[8] == instance[9]);
+        CHECK_FALSE(compiled.is_valid(instance));
+
+        json instance2 = json::parse(
+            R"([1.5,2.5,3.5,4.5,5.5,6.5,7.5,8.5,1e20,300000000000000000000])");
+        CHECK(compiled.is_valid(instance2));
+    }
+}
+
 /*
 : Expected minimum item count: 3, found: 2
 /1: Required key "y" not found